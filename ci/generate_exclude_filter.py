@@ -5,6 +5,8 @@
 import argparse
 import asyncio
 import atexit
+import hashlib
+import json
 import os
 import re
 import shutil
@@ -17,6 +19,20 @@ from timeit import default_timer as timer
 
 enable_verbose_logging = False
 
+# Results of the previous run kept in a persistent build directory
+STATE_FILE = 'exclude_filter_state.json'
+
+# Written by tools/measure_build_time.py into each build directory
+BUILD_TIMES_LOG = 'build_times.log'
+
+# Build directories of the additional slots, relative to the build directory
+SLOTS_DIR = 'slots'
+
+# Sources shared by all test categories, relative to the CTS directory
+SHARED_SOURCES = ['CMakeLists.txt', 'cmake', 'oclmath', 'util',
+                  os.path.join('tests', 'CMakeLists.txt'),
+                  os.path.join('tests', 'common')]
+
 
 class LogLevel(Enum):
     DEFAULT = 37
@@ -48,8 +64,20 @@ def parse_arguments():
                         help="Arguments to pass on to CMake during configuration")
     parser.add_argument('-j', type=int, default=0, dest='parallel_jobs',
                         help="Number of parallel jobs to use during build")
+    parser.add_argument('--slots', type=int, default=1,
+                        help="""Number of categories compiled at the same
+                        time, each in its own build directory sharing the
+                        parallel jobs. The categories are handed out to the
+                        slots longest first according to their recorded
+                        build times.""")
     parser.add_argument('--output', '-o', type=str,
                         help="Name of the output filter file")
+    parser.add_argument('--build-dir', type=str,
+                        help="""Persistent build directory. Subsequent runs
+                        only compile the categories whose sources changed,
+                        unless the toolchain or the shared sources changed,
+                        and schedule them by their recorded build times.
+                        A temporary directory is used by default.""")
     parser.add_argument('--verbose', action='store_true',
                         help="Enable verbose logging")
 
@@ -59,13 +87,40 @@ def parse_arguments():
 def find_all_categories(cts_dir: str):
     tests_dir = os.path.realpath(os.path.join(cts_dir, "tests"))
     return sorted([
-        f.name for f in os.scandir(tests_dir) if f.is_dir() and f.name != 'common'
+        f.name for f in os.scandir(tests_dir)
+        if f.is_dir() and f.name != 'common' and not f.name.startswith('bench_')
     ])
 
 
-def configure_cmake(cts_dir: str, build_dir: str, sycl_impl: str, cmake_args: str):
+def category_of_target(target: str, categories: list):
+    """
+    Maps a target to its test category. Besides test_<category>, a category
+    may build test_<category>_<aspect> executables with the tests requiring
+    an optional aspect, so the longest category the target is prefixed with
+    is chosen, e.g. atomic_ref_stress for test_atomic_ref_stress_atomic64.
+    """
+    name = target[len('test_'):]
+    if name in categories:
+        return name
+    prefixed = [c for c in categories if name.startswith(c + '_')]
+    return max(prefixed, key=len) if prefixed else None
+
+
+def group_targets_by_category(cmake_targets: list, categories: list):
+    targets = {}
+    for t in cmake_targets:
+        c = category_of_target(t, categories)
+        if c is not None:
+            targets.setdefault(c, []).append(t)
+    return targets
+
+
+def configure_cmake(cts_dir: str, build_dir: str, sycl_impl: str, cmake_args: str,
+                    measure_build_times: bool = False):
     cmake_call = f"cmake -S {cts_dir} -B {build_dir} -G Ninja"
     cmake_call += f" -DSYCL_IMPLEMENTATION={sycl_impl} {cmake_args or ''}"
+    if measure_build_times:
+        cmake_call += " -DSYCL_CTS_MEASURE_BUILD_TIMES=ON"
     log(cmake_call, LogLevel.VERBOSE)
     p = subprocess.run(cmake_call, shell=True, capture_output=True)
     if p.returncode != 0:
@@ -116,10 +171,13 @@ def monitor_memory_usage():
         did_warn_memory_usage = True
 
 
-async def compile_all_async(build_dir: str, targets: list, parallel_jobs: int):
+async def compile_all_async(build_dir: str, targets: list, parallel_jobs: int,
+                            clean_first: bool = True,
+                            show_progress: bool = True):
     # Keep going even if some targets fail
     ninja_args = f"-k 0 -j {parallel_jobs}"
-    cmake_call = f"cmake --build {build_dir} --clean-first --target {' '.join(targets)} -- {ninja_args}"
+    clean_arg = "--clean-first " if clean_first else ""
+    cmake_call = f"cmake --build {build_dir} {clean_arg}--target {' '.join(targets)} -- {ninja_args}"
     log(cmake_call, LogLevel.VERBOSE)
 
     proc = await asyncio.create_subprocess_shell(
@@ -129,7 +187,8 @@ async def compile_all_async(build_dir: str, targets: list, parallel_jobs: int):
 
     # Forward only CMake progress outputs (unless --verbose is set)
     progress_pattern = re.compile(r"^\[\d+/\d+\].*$")
-    print("")
+    if show_progress:
+        print("")
     while True:
         monitor_memory_usage()
         buf = await proc.stdout.readline()
@@ -138,7 +197,7 @@ async def compile_all_async(build_dir: str, targets: list, parallel_jobs: int):
         line = buf.decode()
         if enable_verbose_logging:
             log(line, level=LogLevel.VERBOSE)
-        elif progress_pattern.match(line):
+        elif show_progress and progress_pattern.match(line):
             if sys.stdout.isatty():
                 sys.stdout.write("\033[A")
                 sys.stdout.write("\033[K")
@@ -149,14 +208,160 @@ async def compile_all_async(build_dir: str, targets: list, parallel_jobs: int):
     return proc
 
 
-def find_failing_categories(build_dir: str, targets: list):
+async def compile_longest_first_async(slot_dirs: list, categories: list,
+                                      category_targets: dict,
+                                      parallel_jobs: int):
+    """
+    Compiles the categories, which are ordered longest first, on a pool of
+    slots. Concurrent ninja processes cannot share a build directory, so each
+    slot has its own and takes the next category whenever it becomes idle.
+    Returns the build directory each category was compiled in.
+    """
+    queue = list(categories)
+    built_in = {}
+
+    async def run_slot(slot_dir: str):
+        while queue:
+            c = queue.pop(0)
+            ts_before = timer()
+            await compile_all_async(slot_dir, category_targets[c],
+                                    parallel_jobs, clean_first=False,
+                                    show_progress=False)
+            built_in[c] = slot_dir
+            log(f"Compiled {c} in {timer() - ts_before:.1f} seconds "
+                f"({len(built_in)}/{len(categories)}).")
+
+    await asyncio.gather(*(run_slot(d) for d in slot_dirs))
+    return built_in
+
+
+def find_failing_categories(build_dir: str, targets: list, categories: list):
     # Do a dry run to find targets that are out of date (= not built)
     ninja_args = '-n'
     p = subprocess.run(
         f"cmake --build {build_dir} --target {' '.join(targets)} -- {ninja_args}", shell=True, capture_output=True)
     link_target_pattern = re.compile(
-        r"^\[\d+/\d+\] Linking.*?bin/test_(.*)$", flags=re.M)
-    return link_target_pattern.findall(p.stdout.decode())
+        r"^\[\d+/\d+\] Linking.*?bin/(test_.*)$", flags=re.M)
+    failing = [category_of_target(t, categories)
+               for t in link_target_pattern.findall(p.stdout.decode())]
+    return sorted(set(c for c in failing if c is not None))
+
+
+def find_failing_sources(build_dir: str, targets: list):
+    """
+    Narrows a failing category down to its translation units that did not
+    compile. The build keeps going after errors, so these are exactly the
+    objects that are still out of date. A category with no such object
+    failed to link.
+    """
+    p = subprocess.run(
+        f"cmake --build {build_dir} --target {' '.join(targets)} -- -n", shell=True, capture_output=True)
+    object_pattern = re.compile(
+        r"^\[\d+/\d+\] Building CXX object (.*?)(\.o|\.obj)?$", flags=re.M)
+    sources = [re.sub(r"CMakeFiles/[^/]+\.dir/", "", m.group(1))
+               for m in object_pattern.finditer(p.stdout.decode())]
+    return sources or ["<link step>"]
+
+
+def hash_paths(hasher, root: str, paths: list):
+    """
+    Feeds the names and the contents of the files at the given paths relative
+    to root to the hasher, descending into directories in a stable order.
+    """
+    for path in sorted(paths):
+        full_path = os.path.join(root, path)
+        if os.path.isdir(full_path):
+            hash_paths(hasher, root, [os.path.join(path, entry)
+                                      for entry in os.listdir(full_path)])
+        elif os.path.isfile(full_path):
+            hasher.update(path.replace(os.sep, '/').encode() + b'\0')
+            with open(full_path, 'rb') as f:
+                hasher.update(f.read())
+
+
+def hash_category(cts_dir: str, category: str):
+    hasher = hashlib.sha256()
+    hash_paths(hasher, cts_dir, [os.path.join('tests', category)])
+    return hasher.hexdigest()
+
+
+def hash_toolchain(cts_dir: str, build_dir: str, sycl_impl: str, cmake_args: str):
+    """
+    Hashes everything a change of which invalidates the results of all
+    categories: the compiler binary and its version, the configuration
+    arguments and the sources shared by the categories.
+    """
+    hasher = hashlib.sha256()
+    hasher.update(f"{sycl_impl}\0{cmake_args or ''}\0".encode())
+    hash_paths(hasher, cts_dir, SHARED_SOURCES)
+
+    compiler = None
+    with open(os.path.join(build_dir, 'CMakeCache.txt'), 'r') as cache:
+        for line in cache:
+            if line.startswith('CMAKE_CXX_COMPILER:'):
+                compiler = line.split('=', 1)[1].strip()
+    if compiler and os.path.isfile(compiler):
+        hasher.update(compiler.encode() + b'\0')
+        with open(compiler, 'rb') as f:
+            hasher.update(f.read())
+        p = subprocess.run([compiler, '--version'], capture_output=True)
+        hasher.update(p.stdout)
+    else:
+        log("Warning: Could not locate the compiler, only the sources are "
+            "hashed", LogLevel.WARNING)
+    return hasher.hexdigest()
+
+
+def load_state(build_dir: str):
+    try:
+        with open(os.path.join(build_dir, STATE_FILE), 'r') as state_file:
+            return json.load(state_file)
+    except (OSError, ValueError):
+        return {}
+
+
+def save_state(build_dir: str, state: dict):
+    with open(os.path.join(build_dir, STATE_FILE), 'w') as state_file:
+        json.dump(state, state_file, indent=2)
+
+
+def load_build_costs(cts_dir: str, build_dirs: list):
+    """
+    Returns the seconds spent on compiling each category according to the
+    latest time of each object file in the build time logs.
+    """
+    sys.path.insert(0, os.path.join(cts_dir, 'tools'))
+    from measure_build_time import get_category
+
+    log_pattern = re.compile(r"^([\d.]+) (\S+) \((.*)\)$")
+    latest = {}
+    for build_dir in build_dirs:
+        try:
+            with open(os.path.join(build_dir, BUILD_TIMES_LOG), 'r') as log_file:
+                for line in log_file:
+                    m = log_pattern.match(line.strip())
+                    if m:
+                        latest[m.group(3)] = float(m.group(1))
+        except OSError:
+            continue
+
+    costs = {}
+    for source, seconds in latest.items():
+        category = get_category(source)
+        costs[category] = costs.get(category, 0.0) + seconds
+    return costs
+
+
+def order_by_cost(categories: list, costs: dict):
+    """
+    Orders the categories by their recorded build cost, the most expensive
+    first, so the longest categories do not start last and extend the
+    build. Categories with no record are assumed to have the average cost.
+    """
+    known = [costs[c] for c in categories if c in costs]
+    default = sum(known) / len(known) if known else 0.0
+    return sorted(categories, key=lambda c: costs.get(c, default),
+                  reverse=True)
 
 
 def main():
@@ -169,45 +374,128 @@ def main():
     log(f"Found {len(all_categories)} test categories.")
     log(', '.join(all_categories), LogLevel.VERBOSE)
 
-    build_dir = tempfile.mkdtemp(prefix='sycl_cts_')
-    atexit.register(lambda: shutil.rmtree(build_dir))
+    incremental = args.build_dir is not None
+    if incremental:
+        build_dir = os.path.realpath(args.build_dir)
+        os.makedirs(build_dir, exist_ok=True)
+    else:
+        build_dir = tempfile.mkdtemp(prefix='sycl_cts_')
+        atexit.register(lambda: shutil.rmtree(build_dir))
+
+    if args.slots < 1:
+        log("The number of slots must be at least 1", LogLevel.ERROR)
+        exit(1)
+    slot_dirs = [build_dir] + [os.path.join(build_dir, SLOTS_DIR, str(k))
+                               for k in range(1, args.slots)]
 
     log("Configuring CMake...")
-    configure_cmake(cts_dir, build_dir,
-                    args.sycl_implementation, args.cmake_args)
+    for slot_dir in slot_dirs:
+        configure_cmake(cts_dir, slot_dir,
+                        args.sycl_implementation, args.cmake_args,
+                        measure_build_times=incremental)
 
-    cmake_targets = query_cmake_targets(build_dir)
+    # Each category builds test_<category> and a test_<category>_<aspect>
+    # executable per optional aspect its tests require
+    category_targets = group_targets_by_category(
+        query_cmake_targets(build_dir), all_categories)
 
-    missing_targets = []
-    available_targets = []
-    for c in all_categories:
-        t = "test_" + c
-        if t in cmake_targets:
-            available_targets.append(t)
-        else:
-            missing_targets.append(t)
+    missing_targets = ["test_" + c for c in all_categories
+                       if c not in category_targets]
+    available_categories = [c for c in all_categories
+                            if c in category_targets]
 
     if len(missing_targets) != 0:
         log(
             f"Warning: The following {len(missing_targets)} category targets do not exist:", LogLevel.WARNING)
         log(', '.join(missing_targets), LogLevel.WARNING)
 
-    ts_before = timer()
-    log("Attempting to compile all category targets. This may take a while...")
-    asyncio.run(compile_all_async(
-        build_dir, available_targets, args.parallel_jobs))
-    ts_after = timer()
-    log(f"Done after {ts_after - ts_before:.1f} seconds.")
-
-    failing_categories = find_failing_categories(build_dir, available_targets)
+    # The results of the previous run are valid for the categories with
+    # unchanged sources as long as the toolchain is the same
+    state = load_state(build_dir) if incremental else {}
+    toolchain = hash_toolchain(
+        cts_dir, build_dir, args.sycl_implementation, args.cmake_args) if incremental else None
+    toolchain_changed = state.get('toolchain') != toolchain
+    previous = {} if toolchain_changed else state.get('categories', {})
+    category_hashes = {c: hash_category(cts_dir, c)
+                       for c in available_categories}
+    stale_categories = [c for c in available_categories
+                        if previous.get(c, {}).get('hash') !=
+                        category_hashes[c]]
+    reused_categories = [c for c in available_categories
+                         if c not in stale_categories]
+    if incremental:
+        if toolchain_changed:
+            log("Toolchain or shared sources changed, compiling all categories.")
+        else:
+            log(f"Reusing the results of {len(reused_categories)} unchanged categories.")
+
+    stale_categories = order_by_cost(stale_categories,
+                                     load_build_costs(cts_dir, slot_dirs))
+    stale_targets = [t for c in stale_categories
+                     for t in category_targets[c]]
+    log(', '.join(stale_targets), LogLevel.VERBOSE)
+
+    failing_categories = []
+    failing_sources = {}
+    if stale_targets:
+        ts_before = timer()
+        log(f"Attempting to compile {len(stale_targets)} targets of {len(stale_categories)} categories. This may take a while...")
+        clean_first = not incremental or toolchain_changed
+        if len(slot_dirs) == 1:
+            # A single ninja invocation schedules all edges at once
+            asyncio.run(compile_all_async(
+                build_dir, stale_targets, args.parallel_jobs, clean_first))
+            built_in = {c: build_dir for c in stale_categories}
+        else:
+            if clean_first:
+                for slot_dir in slot_dirs:
+                    subprocess.run(f"cmake --build {slot_dir} --target clean",
+                                   shell=True, capture_output=True)
+            jobs = args.parallel_jobs or os.cpu_count() or 1
+            built_in = asyncio.run(compile_longest_first_async(
+                slot_dirs, stale_categories, category_targets,
+                max(1, jobs // len(slot_dirs))))
+        ts_after = timer()
+        log(f"Done after {ts_after - ts_before:.1f} seconds.")
+
+        for slot_dir in slot_dirs:
+            slot_targets = [t for c in stale_categories
+                            if built_in.get(c) == slot_dir
+                            for t in category_targets[c]]
+            if not slot_targets:
+                continue
+            for c in find_failing_categories(slot_dir, slot_targets,
+                                             all_categories):
+                failing_categories.append(c)
+                failing_sources[c] = find_failing_sources(
+                    slot_dir, category_targets[c])
+
+    for c in reused_categories:
+        if previous[c]['failed']:
+            failing_categories.append(c)
+            failing_sources[c] = previous[c].get('failing-sources', [])
 
     if len(failing_categories) > 0:
         log(f"{len(failing_categories)} out of {len(all_categories)} categories failed to compile.")
         log("The following categories did not compile successfully: " +
             ', '.join(sorted(failing_categories)))
+        for c in sorted(failing_categories):
+            log(f"  {c}: {', '.join(failing_sources[c])}")
     else:
         log("All categories compiled successfully!")
 
+    if incremental:
+        save_state(build_dir, {
+            'toolchain': toolchain,
+            'categories': {
+                c: {
+                    'hash': h,
+                    'failed': c in failing_sources,
+                    'failing-sources': failing_sources.get(c, [])
+                } for c, h in category_hashes.items()
+            }
+        })
+
     if args.output is not None:
         log(f"Writing output to file {args.output}", LogLevel.VERBOSE)
         with open(args.output, "w") as output_file:
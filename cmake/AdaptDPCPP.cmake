@@ -6,10 +6,11 @@ target_link_libraries(SYCL::SYCL INTERFACE DPCPP::Runtime)
 # Parameters are:
 #   - NAME             Name of the test executable
 #   - OBJECT_LIBRARY   Name of the object library of all the compiled test cases
+#   - PCH_TARGET       Optional target with the precompiled header to reuse
 #   - TESTS            List of SYCL test case source files to be built into the
 # test executable
 function(add_sycl_executable_implementation)
-    cmake_parse_arguments(args "" "NAME;OBJECT_LIBRARY" "TESTS" ${ARGN})
+    cmake_parse_arguments(args "" "NAME;OBJECT_LIBRARY;PCH_TARGET" "TESTS" ${ARGN})
     set(exe_name            ${args_NAME})
     set(object_lib_name     ${args_OBJECT_LIBRARY})
     set(test_cases_list     ${args_TESTS})
@@ -24,4 +25,24 @@ function(add_sycl_executable_implementation)
         COMPILE_DEFINITIONS $<TARGET_PROPERTY:${exe_name},COMPILE_DEFINITIONS>
         COMPILE_OPTIONS     $<TARGET_PROPERTY:${exe_name},COMPILE_OPTIONS>
         COMPILE_FEATURES    $<TARGET_PROPERTY:${exe_name},COMPILE_FEATURES>)
+
+    if(args_PCH_TARGET)
+        target_precompile_headers(${object_lib_name} REUSE_FROM ${args_PCH_TARGET})
+    endif()
+endfunction()
+
+# add_sycl_pch_implementation function
+# Builds the precompiled header shared by the object libraries of the test
+# executables. DPC++ passes the precompiled header to both the host and the
+# device compilation, which is verified by check_sycl_pch_support().
+# Parameters are:
+#   - NAME      Name of the target building the precompiled header
+#   - SOURCE    Source file compiled along with the precompiled header
+#   - HEADERS   List of headers to precompile
+function(add_sycl_pch_implementation)
+    cmake_parse_arguments(args "" "NAME;SOURCE" "HEADERS" ${ARGN})
+
+    add_library(${args_NAME} OBJECT ${args_SOURCE})
+    add_sycl_to_target(TARGET ${args_NAME} SOURCES ${args_SOURCE})
+    target_precompile_headers(${args_NAME} PRIVATE ${args_HEADERS})
 endfunction()
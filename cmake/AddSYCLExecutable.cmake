@@ -57,16 +57,190 @@ if(NOT COMMAND add_sycl_executable_implementation)
         "  add_sycl_executable_implementation(\n"
         "     NAME <name>\n"
         "     OBJECT_LIBRARY <object_library_name>\n"
+        "     [PCH_TARGET <pch_target_name>]\n"
         "     TESTS <sources>...\n"
         "  )\n"
         "  Builds a SYCL program, compiling multiple SYCL test case source files into a test executable, invoking a single-source/device compiler.\n"
         "  The options are:\n"
         "    NAME             Name of the test executable\n"
         "    OBJECT_LIBRARY   Name of the object library of all the compiled test cases\n"
+        "    PCH_TARGET       Name of the target with the precompiled header to reuse, if any\n"
         "    TESTS            List of SYCL test case source files to be built into the test executable\n"
     )
 endif()
 
+# Headers parsed by most of the test cases, precompiled once per configuration
+# and reused by all the test executables if SYCL_CTS_ENABLE_PCH is ON
+set(SYCL_CTS_PCH_SYSTEM_HEADERS
+    <sycl/sycl.hpp>
+    <catch2/catch_test_macros.hpp>
+    <catch2/catch_template_test_macros.hpp>)
+set(SYCL_CTS_PCH_PROJECT_HEADERS
+    "${PROJECT_SOURCE_DIR}/tests/common/common.h"
+    "${PROJECT_SOURCE_DIR}/tests/common/type_coverage.h")
+
+# Macros configuring the SYCL headers, which have no effect once the headers
+# are precompiled
+set(SYCL_CTS_PCH_CONFIGURATION_MACROS SYCL_SIMPLE_SWIZZLES)
+
+# check_sycl_pch_support function
+# Checks whether the SYCL compiler accepts the precompiled headers in all of
+# its passes by building a small SYCL project with a precompiled header,
+# the result is cached in SYCL_CTS_PCH_SUPPORTED
+function(check_sycl_pch_support)
+    if(DEFINED SYCL_CTS_PCH_SUPPORTED)
+        return()
+    endif()
+
+    if(CMAKE_VERSION VERSION_LESS 3.16)
+        message(WARNING "Precompiled headers require CMake 3.16 or newer, "
+                        "SYCL_CTS_ENABLE_PCH is ignored")
+        set(SYCL_CTS_PCH_SUPPORTED OFF CACHE INTERNAL "")
+        return()
+    endif()
+
+    if(NOT COMMAND add_sycl_pch_implementation)
+        message(WARNING "The ${SYCL_IMPLEMENTATION} adapter does not provide "
+                        "add_sycl_pch_implementation(), "
+                        "SYCL_CTS_ENABLE_PCH is ignored")
+        set(SYCL_CTS_PCH_SUPPORTED OFF CACHE INTERNAL "")
+        return()
+    endif()
+
+    set(check_dir "${CMAKE_BINARY_DIR}/CMakeFiles/sycl_cts_pch_check")
+
+    # Forward the compiler and the SYCL implementation configuration
+    set(settings "set(CMAKE_CXX_COMPILER [==[${CMAKE_CXX_COMPILER}]==])\n")
+    string(APPEND settings "set(CMAKE_CXX_FLAGS [==[$CACHE{CMAKE_CXX_FLAGS}]==])\n")
+    foreach(variable SYCL_IMPLEMENTATION CMAKE_MODULE_PATH CMAKE_PREFIX_PATH)
+        string(APPEND settings "set(${variable} [==[${${variable}}]==])\n")
+    endforeach()
+    get_cmake_property(cache_variables CACHE_VARIABLES)
+    foreach(variable ${cache_variables})
+        if(variable MATCHES "^(DPCPP|hipSYCL|HIPSYCL|AdaptiveCpp|ACPP)_")
+            string(APPEND settings "set(${variable} [==[$CACHE{${variable}}]==])\n")
+        endif()
+    endforeach()
+    file(WRITE "${check_dir}/src/settings.cmake" "${settings}")
+
+    file(WRITE "${check_dir}/src/CMakeLists.txt" [=[
+cmake_minimum_required(VERSION 3.16)
+include("${CMAKE_CURRENT_SOURCE_DIR}/settings.cmake")
+project(sycl_cts_pch_check LANGUAGES CXX)
+set(CMAKE_CXX_STANDARD 17)
+add_library(OpenCL_Proxy INTERFACE)
+add_library(CTS::OpenCL_Proxy ALIAS OpenCL_Proxy)
+find_package(${SYCL_IMPLEMENTATION} REQUIRED)
+include(Adapt${SYCL_IMPLEMENTATION})
+add_sycl_pch_implementation(NAME pch_check_pch SOURCE pch.cpp
+                            HEADERS <sycl/sycl.hpp>)
+add_sycl_executable_implementation(NAME pch_check
+                                   OBJECT_LIBRARY pch_check_objects
+                                   PCH_TARGET pch_check_pch
+                                   TESTS kernel.cpp)
+]=])
+    file(WRITE "${check_dir}/src/pch.cpp" "")
+    # Intentionally relies on the precompiled header for the SYCL definitions
+    file(WRITE "${check_dir}/src/kernel.cpp" [=[
+int main() {
+  sycl::queue queue;
+  int result = 0;
+  {
+    sycl::buffer<int, 1> buffer(&result, sycl::range<1>(1));
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc(buffer, cgh, sycl::write_only);
+      cgh.single_task([=] { acc[0] = 1; });
+    });
+  }
+  return result == 1 ? 0 : 1;
+}
+]=])
+
+    message(STATUS "Checking precompiled header support of the SYCL compiler")
+    try_compile(pch_supported
+        "${check_dir}/build" "${check_dir}/src" sycl_cts_pch_check
+        OUTPUT_VARIABLE check_output)
+    if(pch_supported)
+        message(STATUS "Checking precompiled header support of the SYCL compiler - yes")
+    else()
+        message(WARNING "The SYCL compiler cannot use precompiled headers, "
+                        "SYCL_CTS_ENABLE_PCH is ignored")
+        file(WRITE "${check_dir}/output.log" "${check_output}")
+    endif()
+    set(SYCL_CTS_PCH_SUPPORTED ${pch_supported} CACHE INTERNAL "")
+endfunction()
+
+# get_sycl_cts_pch_target function
+# Returns the target building the shared precompiled header, creating it on
+# the first call, or an empty string if it cannot be used by the test
+# executable defined in the current directory
+function(get_sycl_cts_pch_target out_var tests)
+    set(${out_var} "" PARENT_SCOPE)
+    if(NOT SYCL_CTS_ENABLE_PCH)
+        return()
+    endif()
+    check_sycl_pch_support()
+    if(NOT SYCL_CTS_PCH_SUPPORTED)
+        return()
+    endif()
+
+    # The precompiled header would hide the local headers with the same name
+    # and would differ from the directory specific definitions
+    get_directory_property(directory_definitions COMPILE_DEFINITIONS)
+    if(directory_definitions)
+        return()
+    endif()
+    foreach(header ${SYCL_CTS_PCH_PROJECT_HEADERS})
+        get_filename_component(header_name "${header}" NAME)
+        get_filename_component(header_dir "${header}" DIRECTORY)
+        if(EXISTS "${CMAKE_CURRENT_SOURCE_DIR}/${header_name}" AND
+           NOT header_dir STREQUAL CMAKE_CURRENT_SOURCE_DIR)
+            return()
+        endif()
+    endforeach()
+
+    # Test cases configuring the SYCL headers have to parse them on their own;
+    # generated test cases are checked through their templates
+    list(JOIN SYCL_CTS_PCH_CONFIGURATION_MACROS "|" macros_regex)
+    foreach(test ${tests})
+        get_source_file_property(template "${test}" SYCL_CTS_TEMPLATE)
+        if(template)
+            set(scanned_file "${template}")
+        else()
+            set(scanned_file "${test}")
+        endif()
+        if(EXISTS "${scanned_file}" OR
+           EXISTS "${CMAKE_CURRENT_SOURCE_DIR}/${scanned_file}")
+            file(STRINGS "${scanned_file}" configuration_defines
+                 REGEX "^[ \t]*#[ \t]*define[ \t]+(${macros_regex})")
+            if(configuration_defines)
+                set_source_files_properties("${test}" PROPERTIES
+                    SKIP_PRECOMPILE_HEADERS ON)
+            endif()
+        endif()
+    endforeach()
+
+    set(pch_target sycl_cts_pch)
+    if(NOT TARGET ${pch_target})
+        set(pch_source "${CMAKE_BINARY_DIR}/sycl_cts_pch.cpp")
+        if(NOT EXISTS "${pch_source}")
+            file(WRITE "${pch_source}" "")
+        endif()
+        add_sycl_pch_implementation(
+            NAME    ${pch_target}
+            SOURCE  "${pch_source}"
+            HEADERS ${SYCL_CTS_PCH_SYSTEM_HEADERS}
+                    ${SYCL_CTS_PCH_PROJECT_HEADERS})
+        # Match the compile definitions and include directories of the test
+        # cases, the precompiled header is rejected otherwise
+        target_link_libraries(${pch_target} PRIVATE CTS::util Catch2::Catch2)
+        target_compile_definitions(${pch_target} PRIVATE
+            ${SYCL_CTS_DETAIL_OPTION_COMPILE_DEFINITIONS}
+            "${SYCL_IMPLEMENTATION_DETECTION_MACRO}")
+    endif()
+    set(${out_var} ${pch_target} PARENT_SCOPE)
+endfunction()
+
 # add_sycl_executable function
 # Builds a SYCL program, compiling multiple SYCL test case source files into a test executable, invoking a single-source/device compiler
 # Parameters are:
@@ -80,9 +254,12 @@ function(add_sycl_executable)
         "TESTS"
         ${ARGN})
 
+    get_sycl_cts_pch_target(pch_target "${args_TESTS}")
+
     add_sycl_executable_implementation(
         NAME           "${args_NAME}"
         OBJECT_LIBRARY "${args_OBJECT_LIBRARY}"
+        PCH_TARGET     "${pch_target}"
         TESTS          "${args_TESTS}")
 
     target_compile_definitions(${args_NAME} PUBLIC "-D${SYCL_IMPLEMENTATION_DETECTION_MACRO}")
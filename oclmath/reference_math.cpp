@@ -1976,9 +1976,9 @@ static long double reduce1l( long double x )
 
 static long double reduce1l( long double x )
 {
-    static long double unit_exp = 0; 
-    if( 0.0L == unit_exp )
-        unit_exp = scalbnl( 1.0L, LDBL_MANT_DIG);
+    // Initialized once in a thread-safe manner, the reference can be
+    // evaluated from several host threads at once
+    static const long double unit_exp = scalbnl( 1.0L, LDBL_MANT_DIG);
 
     if( reference_fabsl(x) >= unit_exp )
     {
@@ -3132,13 +3132,10 @@ long double reference_rintl( long double x )
   // mantissa can represent more than LDBL_MANT_DIG binary digits.
   x = rintl(x);
 #else
-    static long double magic[2] = { 0.0L, 0.0L};
-    
-    if( 0.0L == magic[0] )
-    {
-        magic[0] = scalbnl(0.5L, LDBL_MANT_DIG);
-        magic[1] = scalbnl(-0.5L, LDBL_MANT_DIG);
-    }
+    // Initialized once in a thread-safe manner, the reference can be
+    // evaluated from several host threads at once
+    static const long double magic[2] = { scalbnl(0.5L, LDBL_MANT_DIG),
+                                          scalbnl(-0.5L, LDBL_MANT_DIG) };
 
     if( reference_fabsl(x) < magic[0] && x != 0.0L )
     {
@@ -1,11 +1,18 @@
 #!/usr/bin/env python3
 import os
+import hashlib
+import shutil
 import subprocess
 import sys
 import xml.etree.ElementTree as ET
 import json
 import argparse
 import shlex
+import math
+import platform
+import re
+import time
+from concurrent.futures import ThreadPoolExecutor
 
 REPORT_HEADER = """<?xml version="1.0" encoding="UTF-8"?>
 <?xml-stylesheet xmlns="http://www.w3.org/1999/xhtml" type="text/xsl" href="#stylesheet"?>
@@ -83,7 +90,44 @@ def handle_args(argv):
                         help='Test the reduced feature set instead of the full feature set.',
                         required=False,
                         action='store_true')
+    parser.add_argument('--shards',
+                        help='Number of worker processes running the test cases '
+                        'in shards instead of running the executables one by one '
+                        'with CTest. 0 disables sharding.',
+                        type=int,
+                        default=0)
+    parser.add_argument('--tests-per-shard',
+                        help='Number of test cases run by a single process in the '
+                        'sharding mode. Derived from the number of test cases '
+                        'and shards by default.',
+                        type=int,
+                        default=0)
+    parser.add_argument('--device-concurrency',
+                        help='Maximum number of shards using the device at the same '
+                        'time. By default CPU devices are not limited while other '
+                        'devices run one shard at a time.',
+                        type=int,
+                        default=0)
+    parser.add_argument('--slowest-tests',
+                        help='Number of the slowest test cases to list in the report.',
+                        type=int,
+                        default=20)
+    parser.add_argument('--result-cache',
+                        help='Directory caching the results of the test '
+                        'executables. A test executable that passed before is '
+                        'not run again while the executable, the shared '
+                        'libraries it loads, its arguments and the device info '
+                        'it dumps are unchanged. Disabled by default.',
+                        type=str)
+    parser.add_argument('--run-unsupported',
+                        help='Run the test executables requiring aspects the '
+                        'device does not have. By default they are not '
+                        'launched and reported as not run.',
+                        required=False,
+                        action='store_true')
     args = parser.parse_args(argv)
+    result_cache = (os.path.abspath(args.result_cache)
+                    if args.result_cache else None)
 
     full_conformance = 'OFF' if args.fast else 'ON'
     test_deprecated_features = 'OFF' if args.disable_deprecated_features else 'ON'
@@ -93,7 +137,9 @@ def handle_args(argv):
             full_conformance, test_deprecated_features, args.exclude_categories,
             args.implementation_name, args.additional_cmake_args, args.device,
             args.additional_ctest_args, args.build_only,
-            full_feature_set)
+            full_feature_set, args.slowest_tests, args.shards,
+            args.tests_per_shard, args.device_concurrency, result_cache,
+            args.run_unsupported)
 
 
 def split_additional_args(additional_args):
@@ -150,6 +196,15 @@ def generate_ctest_call(additional_ctest_args):
     ] + split_additional_args(additional_ctest_args)
 
 
+def generate_ctest_list_call(additional_ctest_args):
+    """
+    Generates a CTest call listing the test commands as json, used by the
+    sharding mode instead of running the tests with CTest.
+    """
+    return ['ctest', '.', '--show-only=json-v1'
+            ] + split_additional_args(additional_ctest_args)
+
+
 def subprocess_call(parameter_list):
     """
     Calls subprocess.call() with the parameter list.
@@ -160,11 +215,17 @@ def subprocess_call(parameter_list):
 
 
 def configure_and_run_tests(cmake_call, build_system_call, build_only,
-                            ctest_call):
+                            ctest_call, ctest_list_call, shards,
+                            tests_per_shard, device_concurrency, result_cache,
+                            run_unsupported):
     """
     Configures the tests with cmake to produce a ninja.build file.
     Runs the generated ninja file.
-    Runs ctest, overwriting any cached results.
+    Runs ctest, overwriting any cached results, or runs the tests listed by
+    ctest in shards if requested. With a result cache, the tests with a cached
+    result are not run and their results are added to the CTest xml results.
+    Unless requested otherwise, the tests requiring aspects the device does
+    not have are not run either, and are added as not run.
     """
 
     build_system_call = build_system_call.split()
@@ -172,10 +233,626 @@ def configure_and_run_tests(cmake_call, build_system_call, build_only,
     subprocess_call(cmake_call)
     error_code = subprocess_call(build_system_call)
     if (not build_only):
-        error_code = subprocess_call(ctest_call)
+        cached = result_cache.lookup() if result_cache else {}
+        unsupported = ({} if run_unsupported else
+                       find_unsupported_tests(ctest_list_call))
+        excluded = set(cached) | set(unsupported)
+        if shards > 0:
+            error_code = run_sharded_tests(ctest_call, shards, tests_per_shard,
+                                           device_concurrency, excluded)
+        elif excluded:
+            error_code = run_ctest_subset(
+                ctest_call, [name for name, _ in
+                             get_ctest_commands(ctest_list_call)
+                             if name not in excluded])
+        else:
+            error_code = subprocess_call(ctest_call)
+        if result_cache:
+            result_cache.update(cached)
+        if unsupported:
+            add_unsupported_tests(unsupported)
     return error_code
 
 
+# CTest arguments selecting the tests by a regular expression of their names
+CTEST_REGEX_ARGS = ('-R', '--tests-regex')
+
+
+def remove_command_args(command, names):
+    """
+    Returns the command without the given arguments and their values, in
+    any of the forms accepted by CTest.
+    """
+    result = []
+    skip_value = False
+    for arg in command:
+        if skip_value:
+            skip_value = False
+        elif arg in names:
+            skip_value = True
+        elif not any(arg.startswith(name + '=') if name.startswith('--')
+                     else arg.startswith(name) and len(arg) > len(name)
+                     for name in names):
+            # Long arguments may also be given as --name=value, short ones
+            # as -Nvalue
+            result.append(arg)
+    return result
+
+
+def run_ctest_subset(ctest_call, test_names):
+    """
+    Runs the given tests with CTest, or writes empty CTest xml results if
+    there are none left to run. The test names are listed with the additional
+    CTest arguments, so a regular expression passed in them has already been
+    applied and is replaced by the one matching exactly the given tests.
+    """
+    if not test_names:
+        start_time = time.time()
+        site, testing = create_test_xml(start_time)
+        write_test_xml(site, testing, start_time, time.time())
+        return 0
+    return subprocess_call(
+        remove_command_args(ctest_call, CTEST_REGEX_ARGS) +
+        ['-R', '^(%s)$' % '|'.join(re.escape(name) for name in test_names)])
+
+
+# Characters with special meaning in the Catch2 test specification, the
+# wildcard included
+TEST_SPEC_SPECIAL_CHARS = '\\",[]*'
+
+# Characters with special meaning at the start of a test specification, for
+# exclusion and for matching by file name
+TEST_SPEC_LEADING_CHARS = '~#'
+
+# Catch2 exit code is the number of failed assertions capped at 255, any other
+# value means the process was terminated
+CATCH_MAX_EXIT_CODE = 255
+
+
+def escape_test_spec(test_case):
+    """
+    Returns the test specification matching exactly the test case of the
+    given name.
+    """
+    spec = ''.join('\\' + c if c in TEST_SPEC_SPECIAL_CHARS else c
+                   for c in test_case)
+    if spec and spec[0] in TEST_SPEC_LEADING_CHARS:
+        spec = '\\' + spec
+    return spec
+
+
+def replace_command_arg(command, name, value):
+    """
+    Returns the command with the value of the given argument replaced, or with
+    the argument appended if it was not passed.
+    """
+    command = list(command)
+    if name in command:
+        command[command.index(name) + 1] = value
+    else:
+        command += [name, value]
+    return command
+
+
+def get_ctest_commands(ctest_list_call):
+    """
+    Returns the name and the command of each test known to CTest.
+    """
+    print("subprocess.check_output:\n  %s" % " ".join(ctest_list_call))
+    ctest_json = json.loads(subprocess.check_output(ctest_list_call))
+    return [(test['name'], test['command']) for test in ctest_json['tests']
+            if 'command' in test]
+
+
+# Prefix of the CTest labels naming an aspect required by the test, see
+# add_cts_test_requiring_aspect()
+ASPECT_LABEL_PREFIX = 'aspect:'
+
+# Name of the measurement listing the missing aspects of the tests not run
+MISSING_ASPECTS_MEASUREMENT = 'Missing Aspects'
+
+
+def get_required_aspects(ctest_list_call):
+    """
+    Returns the name and the command of each test known to CTest, along with
+    the aspects it requires according to its labels.
+    """
+    print("subprocess.check_output:\n  %s" % " ".join(ctest_list_call))
+    ctest_json = json.loads(subprocess.check_output(ctest_list_call))
+    result = []
+    for test in ctest_json['tests']:
+        if 'command' not in test:
+            continue
+        aspects = set()
+        for prop in test.get('properties', []):
+            if prop['name'] == 'LABELS':
+                aspects.update(label[len(ASPECT_LABEL_PREFIX):]
+                               for label in prop['value']
+                               if label.startswith(ASPECT_LABEL_PREFIX))
+        result.append((test['name'], test['command'], aspects))
+    return result
+
+
+def find_unsupported_tests(ctest_list_call):
+    """
+    Returns the tests requiring aspects missing on the device, each with the
+    list of the missing aspects. The aspects of the device are read from the
+    capabilities in the device info dumped by the first test.
+    """
+    tests = get_required_aspects(ctest_list_call)
+    if not any(aspects for _, _, aspects in tests):
+        return {}
+
+    os.makedirs('Testing', exist_ok=True)
+    name, command, _ = tests[0]
+    info_filename = os.path.join('Testing', name + '.info')
+    try:
+        # Listing the test cases also dumps the device info
+        list_test_cases(
+            replace_command_arg(command, '--info-dump', info_filename))
+        with open(info_filename, 'r') as info:
+            device_aspects = set(json.load(info)['capabilities']['aspects'])
+    except (subprocess.CalledProcessError, OSError, ValueError, KeyError):
+        print("Warning: device capabilities unknown, running all tests")
+        return {}
+
+    unsupported = {}
+    for name, _, aspects in tests:
+        missing = aspects - device_aspects
+        if missing:
+            unsupported[name] = sorted(missing)
+    print("Skipping %d tests requiring aspects missing on the device" %
+          len(unsupported))
+    return unsupported
+
+
+def add_unsupported_tests(unsupported):
+    """
+    Adds the tests that were not run for the aspects missing on the device to
+    the CTest xml results, with the missing aspects as a measurement.
+    """
+    test_xml_file = get_xml_test_results_filename()
+    test_xml_tree = ET.parse(test_xml_file)
+    testing = test_xml_tree.getroot().find('Testing')
+
+    test_list = testing.find('TestList')
+    end = list(testing).index(testing.find('EndDateTime'))
+    for name, missing in sorted(unsupported.items()):
+        ET.SubElement(test_list, 'Test').text = './' + name
+        test = ET.Element('Test', {'Status': 'notrun'})
+        ET.SubElement(test, 'Name').text = name
+        ET.SubElement(test, 'Path').text = '.'
+        ET.SubElement(test, 'FullName').text = './' + name
+        results = ET.SubElement(test, 'Results')
+        measurement = ET.SubElement(results, 'NamedMeasurement', {
+            'type': 'text/string',
+            'name': MISSING_ASPECTS_MEASUREMENT
+        })
+        ET.SubElement(measurement, 'Value').text = ', '.join(missing)
+        ET.SubElement(ET.SubElement(results, 'Measurement'), 'Value').text = (
+            'Not run, the device does not support: %s\n' % ', '.join(missing))
+        testing.insert(end, test)
+        end += 1
+
+    test_xml_tree.write(test_xml_file,
+                        encoding='UTF-8',
+                        xml_declaration=True)
+
+
+def list_test_cases(command):
+    """
+    Returns the names of the test cases run by the test executable by default.
+    """
+    output = subprocess.run(command + ['--list-tests', '--verbosity', 'quiet'],
+                            stdout=subprocess.PIPE,
+                            universal_newlines=True,
+                            check=True).stdout
+    return [line for line in output.splitlines() if line.strip()]
+
+
+def get_device_concurrency(device_concurrency, info_filename, shards):
+    """
+    Returns the number of shards allowed to run at the same time on the device
+    described by the info dump.
+    """
+    if device_concurrency > 0:
+        return min(device_concurrency, shards)
+    with open(info_filename, 'r') as info:
+        device_type = json.load(info)['device-type']
+    if device_type in ('device_type::cpu', 'device_type::host'):
+        return shards
+    return 1
+
+
+class Shard:
+    """
+    Set of test cases of a single test executable run by a single process.
+    """
+
+    def __init__(self, test_name, command, test_cases, shard_id):
+        self.test_name = test_name
+        self.ctest_command = command
+        self.test_cases = test_cases
+        self.name = '%s.shard%d' % (test_name, shard_id)
+        self.spec_filename = os.path.join('Testing', 'shards',
+                                          self.name + '.txt')
+        self.command = replace_command_arg(
+            command, '--info-dump', os.path.join('Testing',
+                                                 self.name + '.info'))
+        self.command = replace_command_arg(
+            self.command, '--timing-dump',
+            os.path.join('Testing', self.name + '.timing.json'))
+        self.command += ['--input-file', self.spec_filename]
+        self.return_code = None
+        self.output = ''
+        self.seconds = 0
+
+    def crashed(self):
+        return self.return_code < 0 or self.return_code > CATCH_MAX_EXIT_CODE
+
+    def run(self):
+        with open(self.spec_filename, 'w') as spec_file:
+            for test_case in self.test_cases:
+                spec_file.write(escape_test_spec(test_case) + '\n')
+        start = time.time()
+        result = subprocess.run(self.command,
+                                stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT,
+                                universal_newlines=True,
+                                errors='replace')
+        self.seconds = time.time() - start
+        self.return_code = result.returncode
+        self.output = result.stdout
+        return self
+
+
+def create_shards(ctest_commands, shards, tests_per_shard):
+    """
+    Splits the test cases of every test executable into shards, the largest
+    executables go first to keep all workers busy until the end of the run.
+    """
+    test_cases = [(name, command, list_test_cases(command))
+                  for name, command in ctest_commands]
+    if tests_per_shard <= 0:
+        # A few shards per worker balance the load without paying the startup
+        # cost of the test executable for every test case
+        total = sum(len(cases) for _, _, cases in test_cases)
+        tests_per_shard = max(1, math.ceil(total / (shards * 4)))
+
+    result = []
+    test_cases.sort(key=lambda test: len(test[2]), reverse=True)
+    for name, command, cases in test_cases:
+        for first in range(0, len(cases), tests_per_shard):
+            result.append(
+                Shard(name, command, cases[first:first + tests_per_shard],
+                      len(result)))
+    return result
+
+
+def run_sharded_tests(ctest_list_call, shards, tests_per_shard,
+                      device_concurrency, excluded=()):
+    """
+    Runs the test cases of all the tests known to CTest in shards over the
+    given number of processes, retrying crashed shards one test case at a time
+    with no other shard running. The results are written as the CTest xml
+    results, so they can be used for the report in the same way. The excluded
+    tests, e.g. the ones with a cached result, are not run.
+    """
+    os.makedirs(os.path.join('Testing', 'shards'), exist_ok=True)
+    start_time = time.time()
+
+    ctest_commands = get_ctest_commands(ctest_list_call)
+    if not ctest_commands:
+        print("Fatal error: CTest did not list any tests")
+        exit(-1)
+
+    # Listing the test cases also dumps the device info
+    ctest_commands = [
+        (name,
+         replace_command_arg(command, '--info-dump',
+                             os.path.join('Testing', name + '.info')))
+        for name, command in ctest_commands
+    ]
+    # The device info of the excluded tests is dumped by the result cache or
+    # when looking for the unsupported tests
+    info_filename = os.path.join('Testing', ctest_commands[0][0] + '.info')
+    ctest_commands = [(name, command) for name, command in ctest_commands
+                      if name not in excluded]
+    shard_list = create_shards(ctest_commands, shards, tests_per_shard)
+    workers = get_device_concurrency(device_concurrency, info_filename,
+                                     shards)
+    print("Running %d shards over %d processes" % (len(shard_list), workers))
+
+    with ThreadPoolExecutor(max_workers=workers) as executor:
+        finished = list(executor.map(Shard.run, shard_list))
+
+    results = []
+    next_shard_id = len(shard_list)
+    for shard in finished:
+        if not shard.crashed() or len(shard.test_cases) == 1:
+            results.append(shard)
+            continue
+        print("Shard %s crashed, retrying its test cases in isolation" %
+              shard.name)
+        for test_case in shard.test_cases:
+            retry = Shard(shard.test_name, shard.ctest_command, [test_case],
+                          next_shard_id)
+            next_shard_id += 1
+            results.append(retry.run())
+
+    end_time = time.time()
+    write_sharded_test_results(ctest_commands, results, start_time, end_time)
+    return 0 if all(shard.return_code == 0 for shard in results) else 1
+
+
+def create_test_xml(start_time):
+    """
+    Returns the root and the Testing element of CTest xml results with no
+    tests.
+    """
+    site = ET.Element(
+        'Site', {
+            'Name': platform.node(),
+            'OSName': platform.system(),
+            'OSRelease': platform.release(),
+            'OSVersion': platform.version(),
+            'OSPlatform': platform.machine(),
+            'NumberOfLogicalCPU': str(os.cpu_count())
+        })
+    testing = ET.SubElement(site, 'Testing')
+    ET.SubElement(testing, 'StartDateTime').text = time.strftime(
+        '%b %d %H:%M %Z', time.localtime(start_time))
+    ET.SubElement(testing, 'StartTestTime').text = str(int(start_time))
+    ET.SubElement(testing, 'TestList')
+    return site, testing
+
+
+def write_test_xml(site, testing, start_time, end_time):
+    """
+    Writes the CTest xml results under a new tag, so they are found in the
+    same way as the results written by CTest.
+    """
+    tag = time.strftime('%Y%m%d-%H%M', time.localtime(start_time))
+    os.makedirs(os.path.join('Testing', tag), exist_ok=True)
+    with open(os.path.join('Testing', 'TAG'), 'w') as tag_file:
+        tag_file.write(tag + '\nExperimental\n')
+
+    ET.SubElement(testing, 'EndDateTime').text = time.strftime(
+        '%b %d %H:%M %Z', time.localtime(end_time))
+    ET.SubElement(testing, 'EndTestTime').text = str(int(end_time))
+    ET.ElementTree(site).write(os.path.join('Testing', tag, 'Test.xml'),
+                               encoding='UTF-8',
+                               xml_declaration=True)
+
+
+def write_sharded_test_results(ctest_commands, shard_results, start_time,
+                               end_time):
+    """
+    Merges the shard results per test executable and writes them in the
+    format of the CTest xml results.
+    """
+    site, testing = create_test_xml(start_time)
+    test_list = testing.find('TestList')
+    for name, _ in ctest_commands:
+        ET.SubElement(test_list, 'Test').text = './' + name
+
+    for name, command in ctest_commands:
+        shards = [shard for shard in shard_results if shard.test_name == name]
+        passed = all(shard.return_code == 0 for shard in shards)
+        output = ''
+        for shard in shards:
+            output += '=== %s: %d test case(s), exit code %d ===\n' % (
+                shard.name, len(shard.test_cases), shard.return_code)
+            output += shard.output
+        test = ET.SubElement(testing, 'Test',
+                             {'Status': 'passed' if passed else 'failed'})
+        ET.SubElement(test, 'Name').text = name
+        ET.SubElement(test, 'Path').text = '.'
+        ET.SubElement(test, 'FullName').text = './' + name
+        ET.SubElement(test, 'FullCommandLine').text = ' '.join(command)
+        results = ET.SubElement(test, 'Results')
+        measurement = ET.SubElement(results, 'NamedMeasurement', {
+            'type': 'numeric/double',
+            'name': 'Execution Time'
+        })
+        ET.SubElement(measurement, 'Value').text = '%.3f' % sum(
+            shard.seconds for shard in shards)
+        ET.SubElement(ET.SubElement(results, 'Measurement'),
+                      'Value').text = output
+
+    write_test_xml(site, testing, start_time, end_time)
+
+
+# Name of the measurement marking the results reused from the result cache
+CACHED_RESULT_MEASUREMENT = 'Cached Result'
+
+# Suffix of the timing dumps written by the test executables
+TIMING_SUFFIX = '.timing.json'
+
+
+def hash_file(hasher, filename):
+    """
+    Feeds the content of the file to the hasher.
+    """
+    with open(filename, 'rb') as input_file:
+        for chunk in iter(lambda: input_file.read(1 << 20), b''):
+            hasher.update(chunk)
+
+
+def get_shared_libraries(executable):
+    """
+    Returns the paths of the shared libraries loaded by the executable as
+    resolved by ldd, or no libraries where ldd is not available.
+    """
+    try:
+        output = subprocess.run(['ldd', executable],
+                                stdout=subprocess.PIPE,
+                                stderr=subprocess.DEVNULL,
+                                universal_newlines=True).stdout
+    except OSError:
+        return []
+    libraries = set()
+    for line in output.splitlines():
+        # Either 'libname.so => /path/libname.so (address)' or
+        # '/path/libname.so (address)'
+        fields = line.split('=>')[-1].split()
+        if fields and os.path.isabs(fields[0]) and os.path.isfile(fields[0]):
+            libraries.add(fields[0])
+    return sorted(libraries)
+
+
+def get_result_key(command, info_filename):
+    """
+    Returns the hash of the test executable, the shared libraries it loads,
+    its arguments and the device info it dumped.
+    """
+    hasher = hashlib.sha256()
+    executable = shutil.which(command[0]) or command[0]
+    for filename in [executable] + get_shared_libraries(executable):
+        hasher.update(filename.encode() + b'\0')
+        hash_file(hasher, filename)
+    # The paths of the dumps do not affect the results
+    arguments = replace_command_arg(command[1:], '--info-dump', '')
+    arguments = replace_command_arg(arguments, '--timing-dump', '')
+    hasher.update('\0'.join(arguments).encode() + b'\0')
+    hash_file(hasher, info_filename)
+    return hasher.hexdigest()
+
+
+class ResultCache:
+    """
+    Results of the tests known to CTest that passed in the previous runs, each
+    one stored with the key of the test executable it was produced by.
+    """
+
+    def __init__(self, directory, ctest_list_call):
+        self.directory = directory
+        self.ctest_list_call = ctest_list_call
+        self.keys = {}
+        self.start_time = None
+
+    def entry_filename(self, name):
+        return os.path.join(self.directory, name + '.json')
+
+    def lookup(self):
+        """
+        Computes the key of every test and returns the cached entries
+        matching it by the test name.
+        """
+        os.makedirs(self.directory, exist_ok=True)
+        os.makedirs('Testing', exist_ok=True)
+        self.start_time = time.time()
+        cached = {}
+        for name, command in get_ctest_commands(self.ctest_list_call):
+            info_filename = os.path.join('Testing', name + '.info')
+            command = replace_command_arg(command, '--info-dump',
+                                          info_filename)
+            try:
+                # Listing the test cases also dumps the device info
+                list_test_cases(command)
+                key = get_result_key(command, info_filename)
+            except (subprocess.CalledProcessError, OSError):
+                key = None
+            self.keys[name] = key
+            try:
+                with open(self.entry_filename(name), 'r') as entry_file:
+                    entry = json.load(entry_file)
+            except (OSError, ValueError):
+                continue
+            if key is not None and entry.get('key') == key:
+                cached[name] = entry
+        print("Reusing cached results of %d of %d tests" %
+              (len(cached), len(self.keys)))
+        return cached
+
+    def collect_timing(self, name):
+        """
+        Returns the timing of the test cases dumped by the test during the
+        current run, including the dumps of its shards.
+        """
+        test_cases = []
+        for filename in os.listdir('Testing'):
+            path = os.path.join('Testing', filename)
+            if (filename.split('.')[0] != name or
+                    not filename.endswith(TIMING_SUFFIX) or
+                    os.path.getmtime(path) < self.start_time):
+                continue
+            with open(path, 'r') as timing_file:
+                try:
+                    test_cases += json.load(timing_file)['test-cases']
+                except (ValueError, KeyError):
+                    pass
+        return test_cases
+
+    def restore_timing(self, name, test_cases):
+        """
+        Replaces the timing dumps of a cached test by its cached timing, so
+        the report lists its test cases once.
+        """
+        for filename in os.listdir('Testing'):
+            if (filename.split('.')[0] == name and
+                    filename.endswith(TIMING_SUFFIX)):
+                os.remove(os.path.join('Testing', filename))
+        with open(os.path.join('Testing', name + '.cached' + TIMING_SUFFIX),
+                  'w') as timing_file:
+            json.dump({'test-cases': test_cases}, timing_file)
+
+    def store(self, name, test):
+        """
+        Writes the xml result of a test to the cache.
+        """
+        entry = {
+            'key': self.keys[name],
+            'date': time.strftime('%Y-%m-%d %H:%M:%S %Z'),
+            'test': ET.tostring(test, encoding='unicode'),
+            'test-cases': self.collect_timing(name)
+        }
+        filename = self.entry_filename(name)
+        with open(filename + '.tmp', 'w') as entry_file:
+            json.dump(entry, entry_file)
+        os.replace(filename + '.tmp', filename)
+
+    def update(self, cached):
+        """
+        Stores the results of the tests that passed in the current run, then
+        adds the cached results to the CTest xml results, marked with the
+        cached result measurement holding the date they were produced.
+        """
+        test_xml_file = get_xml_test_results_filename()
+        test_xml_tree = ET.parse(test_xml_file)
+        testing = test_xml_tree.getroot().find('Testing')
+
+        for test in testing.findall('Test'):
+            name = test.findtext('Name')
+            # The timing restored by a previous run is outdated
+            stale_timing = os.path.join('Testing',
+                                        name + '.cached' + TIMING_SUFFIX)
+            if name not in cached and os.path.isfile(stale_timing):
+                os.remove(stale_timing)
+            if (self.keys.get(name) is not None and name not in cached and
+                    test.get('Status') == 'passed'):
+                self.store(name, test)
+
+        test_list = testing.find('TestList')
+        end = list(testing).index(testing.find('EndDateTime'))
+        for name, entry in sorted(cached.items()):
+            ET.SubElement(test_list, 'Test').text = './' + name
+            test = ET.fromstring(entry['test'])
+            measurement = ET.Element('NamedMeasurement', {
+                'type': 'text/string',
+                'name': CACHED_RESULT_MEASUREMENT
+            })
+            ET.SubElement(measurement, 'Value').text = entry['date']
+            test.find('Results').insert(0, measurement)
+            testing.insert(end, test)
+            end += 1
+            self.restore_timing(name, entry['test-cases'])
+
+        test_xml_tree.write(test_xml_file,
+                            encoding='UTF-8',
+                            xml_declaration=True)
+
+
 def collect_info_filenames():
     """
     Collects all the .info test result files in the Testing directory.
@@ -216,16 +893,72 @@ def get_valid_json_info(info_filenames):
     return json.loads(reference_info)
 
 
-def get_xml_test_results():
+def collect_timing(slowest_count, start_time):
     """
-    Finds the xml file output by the test and returns the rool of the xml tree.
+    Collects the per-test timing dumped by each test executable next to its
+    .info file and returns the slowest test cases over all executables. The
+    dumps left by earlier runs in the build directory are ignored.
+    """
+
+    test_cases = []
+    for filename in os.listdir('Testing'):
+        path = os.path.join('Testing', filename)
+        if (not filename.endswith(TIMING_SUFFIX) or
+                os.path.getmtime(path) < start_time):
+            continue
+        # Sharded runs dump the timing of every shard separately
+        executable = filename[:-len(TIMING_SUFFIX)].split('.')[0]
+        with open(path, 'r') as timing_file:
+            try:
+                timing = json.load(timing_file)
+            except ValueError:
+                # The executable may crash before writing out the timing
+                print('Warning: ignoring malformed timing dump ' + filename)
+                continue
+        for test_case in timing['test-cases']:
+            test_case['executable'] = executable
+            test_cases.append(test_case)
+
+    test_cases.sort(key=lambda test_case: test_case['seconds'], reverse=True)
+    return test_cases[:slowest_count]
+
+
+def add_slowest_tests(test_xml_root, slowest_tests):
+    """
+    Adds the slowest test cases to the xml tree to be shown as a table in the
+    conformance report.
+    """
+
+    slowest_xml = ET.SubElement(test_xml_root, 'SlowestTests')
+    for test_case in slowest_tests:
+        ET.SubElement(
+            slowest_xml, 'TestCase', {
+                'Executable': test_case['executable'],
+                'Name': test_case['name'],
+                'Seconds': '%.3f' % test_case['seconds'],
+                'QueuesCreated': str(test_case['queues-created']),
+                'SharedQueueRequests': str(
+                    test_case['shared-queue-requests'])
+            })
+    return test_xml_root
+
+
+def get_xml_test_results_filename():
+    """
+    Returns the name of the xml file output by the test.
     """
     test_tag = ""
     with open(os.path.join("Testing", "TAG"), 'r') as tag_file:
         test_tag = tag_file.readline()[:-1]
 
-    test_xml_file = os.path.join("Testing", test_tag, "Test.xml")
-    test_xml_tree = ET.parse(test_xml_file)
+    return os.path.join("Testing", test_tag, "Test.xml")
+
+
+def get_xml_test_results():
+    """
+    Finds the xml file output by the test and returns the rool of the xml tree.
+    """
+    test_xml_tree = ET.parse(get_xml_test_results_filename())
     return test_xml_tree.getroot()
 
 
@@ -257,6 +990,9 @@ def update_xml_attribs(info_json, implementation_name, test_xml_root,
     # TODO: Revisit this for SYCL 2020 aspects
     test_xml_root.attrib["DeviceFP16"] = info_json['device-fp16']
     test_xml_root.attrib["DeviceFP64"] = info_json['device-fp64']
+    if 'capabilities' in info_json:
+        test_xml_root.attrib["DeviceAspects"] = ', '.join(
+            info_json['capabilities']['aspects'])
 
     # Set Build Information attribs
     test_xml_root.attrib["FullConformanceMode"] = full_conformance
@@ -276,7 +1012,8 @@ def main(argv=sys.argv[1:]):
     (cmake_exe, build_system_name, build_system_call, full_conformance,
      test_deprecated_features, exclude_categories, implementation_name,
      additional_cmake_args, device, additional_ctest_args,
-     build_only, full_feature_set) = handle_args(argv)
+     build_only, full_feature_set, slowest_count, shards, tests_per_shard,
+     device_concurrency, result_cache_dir, run_unsupported) = handle_args(argv)
 
     # Generate a cmake call in a form accepted by subprocess.call()
     cmake_call = generate_cmake_call(cmake_exe, build_system_name,
@@ -285,8 +1022,17 @@ def main(argv=sys.argv[1:]):
                                      additional_cmake_args, device,
                                      full_feature_set)
 
-    # Generate a CTest call in a form accepted by subprocess.call()
-    ctest_call = generate_ctest_call(additional_ctest_args)
+    # Generate a CTest call in a form accepted by subprocess.call(); the
+    # sharding mode only lists the tests with CTest
+    if shards > 0:
+        ctest_call = generate_ctest_list_call(additional_ctest_args)
+    else:
+        ctest_call = generate_ctest_call(additional_ctest_args)
+
+    ctest_list_call = generate_ctest_list_call(additional_ctest_args)
+    result_cache = None
+    if result_cache_dir is not None:
+        result_cache = ResultCache(result_cache_dir, ctest_list_call)
 
     # Make a build directory if required and enter it
     if not os.path.isdir('build'):
@@ -294,8 +1040,12 @@ def main(argv=sys.argv[1:]):
     os.chdir('build')
 
     # Configure the build system with cmake, run the build, and run the tests.
+    run_start_time = time.time()
     error_code = configure_and_run_tests(cmake_call, build_system_call,
-                                         build_only, ctest_call)
+                                         build_only, ctest_call,
+                                         ctest_list_call, shards,
+                                         tests_per_shard, device_concurrency,
+                                         result_cache, run_unsupported)
 
     if build_only:
         return error_code
@@ -313,6 +1063,11 @@ def main(argv=sys.argv[1:]):
                                          test_deprecated_features,
                                          full_feature_set)
 
+    # Add the slowest test cases based on the timing dumped by each test.
+    result_xml_root = add_slowest_tests(result_xml_root,
+                                        collect_timing(slowest_count,
+                                                       run_start_time))
+
     # Get the xml report stylesheet and add it to the results.
     stylesheet_xml_file = os.path.join("..", "tools", "stylesheet.xml")
     stylesheet_xml_tree = ET.parse(stylesheet_xml_file)
@@ -25,6 +25,7 @@
 
 #include "../../util/sycl_exceptions.h"
 #include "../common/common.h"
+#include "../common/diagnostic_context.h"
 #include "../common/once_per_unit.h"
 #include "../common/section_name_builder.h"
 #include "../common/type_list.h"
@@ -92,7 +93,8 @@ inline std::string get_section_name(const std::string& type_name,
                                     const std::string& access_mode_name,
                                     const std::string& target_name,
                                     const std::string& section_description) {
-  return section_name(section_description)
+  // Catch2 tracks the sections by name, so only the name is rendered here
+  return sycl_cts::diagnostic_context(section_description.c_str())
       .with("T", type_name)
       .with("access mode", access_mode_name)
       .with("target", target_name)
@@ -115,7 +117,7 @@ template <int Dimension>
 inline std::string get_section_name(const std::string& type_name,
                                     const std::string& access_mode_name,
                                     const std::string& section_description) {
-  return section_name(section_description)
+  return sycl_cts::diagnostic_context(section_description.c_str())
       .with("T", type_name)
       .with("access mode", access_mode_name)
       .with("dimension", Dimension)
@@ -134,7 +136,7 @@ inline std::string get_section_name(const std::string& type_name,
 template <int Dimension>
 inline std::string get_section_name(const std::string& type_name,
                                     const std::string& section_description) {
-  return section_name(section_description)
+  return sycl_cts::diagnostic_context(section_description.c_str())
       .with("T", type_name)
       .with("dimension", Dimension)
       .create();
@@ -203,19 +205,36 @@ inline auto get_conformance_type_pack() {
  *        or for reduce types in regular mode
  * @tparam action Functor template for test to run
  * @tparam actionArgsT Parameter pack to use for functor template instantiation
+ * @tparam Shard Part of the types to run the test for, all the types unless
+ *         the source is split by shard_cts_test_sources()
  */
 template <template <typename, typename...> class action,
-          typename... actionArgsT>
+          typename... actionArgsT,
+          typename Shard = SYCL_CTS_TYPE_COVERAGE_SHARD>
 void common_run_tests() {
   const auto types = get_conformance_type_pack();
+  for_type_pack_shard<Shard>(types, [](const auto &shard_types) {
 #if SYCL_CTS_ENABLE_FULL_CONFORMANCE
-  for_all_types_vectors_marray<action, actionArgsT...>(types);
+    for_all_types_vectors_marray<action, actionArgsT...>(shard_types);
 #else
-  for_all_types<action, actionArgsT...>(types);
-  for_type_vectors_marray_reduced<action, int, actionArgsT...>("int");
+    for_all_types<action, actionArgsT...>(shard_types);
 #endif
-  for_all_types<action, actionArgsT...>(
-      named_type_pack<user_struct>::generate("user_struct"));
+  });
+  // The remaining types continue the round-robin over the shards
+  constexpr size_t type_count = std::tuple_size_v<decltype(types.names)>;
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+  constexpr size_t user_struct_position = type_count;
+#else
+  if constexpr (Shard::covers(type_count)) {
+    for_type_vectors_marray_reduced<action, int, actionArgsT...>("int");
+  }
+  constexpr size_t user_struct_position = type_count + 1;
+#endif
+  for_type_pack_shard<Shard, user_struct_position>(
+      named_type_pack<user_struct>::generate("user_struct"),
+      [](const auto &shard_types) {
+        for_all_types<action, actionArgsT...>(shard_types);
+      });
 }
 
 /**
@@ -39,7 +39,7 @@ class atomic_ref_T_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const auto description = get_diagnostic_context(
         type_name, memory_order, memory_scope, address_space,
         "Check if operator T() const loads the value of the object"
         " referenced by this atomic_ref in device code");
@@ -53,15 +53,15 @@ class atomic_ref_T_op_test
     if constexpr (base::address_space_is_not_local_space()) {
       std::array result{false};
       this->queue_submit_global_scope(result, t_op_test);
-      INFO(description + " (global space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "(global space)");
+      DEFERRED_CHECK(result[0]);
     }
 
     if constexpr (base::address_space_is_not_global_space()) {
       std::array result{false};
       this->queue_submit_local_scope(result, t_op_test);
-      INFO(description + " (local space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "(local space)");
+      DEFERRED_CHECK(result[0]);
     }
   }
 
@@ -36,8 +36,9 @@ namespace atomic_ref::tests::api::core {
 // hipsycl
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref::operator T() test. double *", "[atomic_ref]")({
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP(
         "Device does not support double precision floating point "
         "operations.");
@@ -36,38 +36,39 @@ class atomic_ref_add_sub_op_all_types_test
   operand_type operand_val;
 
   void check_test_result_buffer(std::array<bool, 6>& result,
-                                const std::string& description,
+                                const diagnostic_context& description,
                                 std::string addr_space) {
     {
-      INFO(description + "\nError returned val for add (" + addr_space +
-           " space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "Error returned val for add (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[0]);
     }
     {
-      INFO(description + "\nError, referenced val is not updated after add (" +
-           addr_space + " space)");
-      CHECK(result[1]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after add (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[1]);
     }
     {
-      INFO(description + "\nError returned val for subtract (" + addr_space +
-           " space)");
-      CHECK(result[2]);
+      DEFERRED_INFO(description, "Error returned val for subtract (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[2]);
     }
     {
-      INFO(description +
-           "\nError, referenced val is not updated after subtract (" +
-           addr_space + " space)");
-      CHECK(result[3]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after subtract (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[3]);
     }
     {
-      INFO(description + "\nError returned type for add (" + addr_space +
-           " space)");
-      CHECK(result[4]);
+      DEFERRED_INFO(description, "Error returned type for add (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[4]);
     }
     {
-      INFO(description + "\nError returned type for subtract (" + addr_space +
-           " space)");
-      CHECK(result[5]);
+      DEFERRED_INFO(description, "Error returned type for subtract (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[5]);
     }
   }
 
@@ -88,7 +89,7 @@ class atomic_ref_add_sub_op_all_types_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const auto description = get_diagnostic_context(
         type_name, memory_order, memory_scope, address_space,
         "Check if operator+=()/operator-=() adds/subtract the operand to the "
         "object referenced by this atomic_ref"
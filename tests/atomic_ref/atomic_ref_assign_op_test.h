@@ -39,11 +39,11 @@ class atomic_ref_assign_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         "Check if operator=() stores \"desired\" to the object"
-                         " referenced by this atomic_ref and returned value is "
-                         "\"desired\" in device code");
+    const auto description = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space,
+        "Check if operator=() stores \"desired\" to the object"
+        " referenced by this atomic_ref and returned value is "
+        "\"desired\" in device code");
     auto assign_op_test = [](T val_expd, T val_chgd,
                              typename base::atomic_ref_type& a_r,
                              auto result_acc, auto ref_data_acc) {
@@ -57,21 +57,20 @@ class atomic_ref_assign_op_test
       std::array result{false, false, false};
       this->queue_submit_global_scope(result, assign_op_test);
       {
-        INFO(
-            description +
-            "\nError, call of operator=() didn't update referenced val (global "
-            "space)");
-        CHECK(result[0]);
+        DEFERRED_INFO(description,
+                      "Error, call of operator=() didn't update referenced "
+                      "val (global space)");
+        DEFERRED_CHECK(result[0]);
       }
       {
-        INFO(description +
-             "\nError returned value of operator=() (global space)");
-        CHECK(result[1]);
+        DEFERRED_INFO(description,
+                      "Error returned value of operator=() (global space)");
+        DEFERRED_CHECK(result[1]);
       }
       {
-        INFO(description +
-             "\nError returned type of operator=() (global space)");
-        CHECK(result[2]);
+        DEFERRED_INFO(description,
+                      "Error returned type of operator=() (global space)");
+        DEFERRED_CHECK(result[2]);
       }
     }
 
@@ -79,20 +78,20 @@ class atomic_ref_assign_op_test
       std::array result{false, false, false};
       this->queue_submit_local_scope(result, assign_op_test);
       {
-        INFO(description +
-             "\nError, call of operator=() didn't update referenced val (local "
-             "space)");
-        CHECK(result[0]);
+        DEFERRED_INFO(description,
+                      "Error, call of operator=() didn't update referenced "
+                      "val (local space)");
+        DEFERRED_CHECK(result[0]);
       }
       {
-        INFO(description +
-             "\nError returned value of operator=() (local space)");
-        CHECK(result[1]);
+        DEFERRED_INFO(description,
+                      "Error returned value of operator=() (local space)");
+        DEFERRED_CHECK(result[1]);
       }
       {
-        INFO(description +
-             "\nError returned type of operator=() (local space)");
-        CHECK(result[2]);
+        DEFERRED_INFO(description,
+                      "Error returned type of operator=() (local space)");
+        DEFERRED_CHECK(result[2]);
       }
     }
   }
@@ -33,52 +33,54 @@ class atomic_ref_bitwise_op_test
   using base = atomic_ref_test<T, MemoryOrderT, MemoryScopeT, AddressSpaceT>;
 
   void check_test_result_buffer(std::array<bool, 9>& result,
-                                const std::string& description,
+                                const diagnostic_context& description,
                                 std::string addr_space) {
     {
-      INFO(description + "\nError returned val for xor (" + addr_space +
-           " space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "Error returned val for xor (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[0]);
     }
     {
-      INFO(description + "\nError, referenced val is updated after xor (" +
-           addr_space + " space)");
-      CHECK(result[1]);
+      DEFERRED_INFO(description, "Error, referenced val is updated after xor (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[1]);
     }
     {
-      INFO(description + "\nErro returned val for or (" + addr_space +
-           " space)");
-      CHECK(result[2]);
+      DEFERRED_INFO(description, "Erro returned val for or (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[2]);
     }
     {
-      INFO(description + "\nError, referenced val is not updated after or (" +
-           addr_space + " space)");
-      CHECK(result[3]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after or (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[3]);
     }
     {
-      INFO(description + "\nError returned val for and (" + addr_space +
-           " space)");
-      CHECK(result[4]);
+      DEFERRED_INFO(description, "Error returned val for and (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[4]);
     }
     {
-      INFO(description + "\nError, referenced val is not updated after and (" +
-           addr_space + " space)");
-      CHECK(result[5]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after and (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[5]);
     }
     {
-      INFO(description + "\nError returned type for xor (" + addr_space +
-           " space)");
-      CHECK(result[6]);
+      DEFERRED_INFO(description, "Error returned type for xor (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[6]);
     }
     {
-      INFO(description + "\nError returned type for or (" + addr_space +
-           " space)");
-      CHECK(result[7]);
+      DEFERRED_INFO(description, "Error returned type for or (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[7]);
     }
     {
-      INFO(description + "\nError returned type for and (" + addr_space +
-           " space)");
-      CHECK(result[8]);
+      DEFERRED_INFO(description, "Error returned type for and (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[8]);
     }
   }
 
@@ -90,7 +92,7 @@ class atomic_ref_bitwise_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const auto description = get_diagnostic_context(
         type_name, memory_order, memory_scope, address_space,
         "Check operator^=(), operator|=(), operator&=() in device code");
     auto bitwise_op_test = [](T val_expd, T val_chgd,
@@ -25,6 +25,7 @@
 
 #include "../../util/accuracy.h"
 #include "../common/common.h"
+#include "../common/diagnostic_context.h"
 #include "../common/section_name_builder.h"
 #include "../common/type_coverage.h"
 #include "../common/type_list.h"
@@ -52,7 +53,7 @@ inline std::string get_section_name(const std::string& type_name,
                                     const std::string& memory_scope_name,
                                     const std::string& address_space_name,
                                     const std::string& section_description) {
-  return section_name(section_description)
+  return diagnostic_context(section_description.c_str())
       .with("T", type_name)
       .with("memory_order", memory_order_name)
       .with("memory_scope", memory_scope_name)
@@ -83,7 +84,7 @@ inline std::string get_section_name(const std::string& type_name,
                                     const sycl::memory_order& memory_order,
                                     const sycl::memory_scope& memory_scope,
                                     const std::string& section_description) {
-  return section_name(section_description)
+  return diagnostic_context(section_description.c_str())
       .with("T", type_name)
       .with("memory_order", memory_order_name)
       .with("memory_scope", memory_scope_name)
@@ -93,6 +94,58 @@ inline std::string get_section_name(const std::string& type_name,
       .create();
 }
 
+/**
+ * @brief Function helps to get the diagnostic context with the same text as
+ * get_section_name(), which is rendered only if reported by DEFERRED_INFO()
+ *
+ * @param type_name String with name of the testing type
+ * @param memory_order_name String with name of the testing memory_order
+ * @param memory_scope_name String with name of the testing memory_scope
+ * @param address_space String with name of the address_space
+ * @param description String literal with human-readable description of the
+ * test
+ * @return diagnostic_context Context referencing the given strings
+ */
+inline diagnostic_context get_diagnostic_context(
+    const std::string& type_name, const std::string& memory_order_name,
+    const std::string& memory_scope_name, const std::string& address_space_name,
+    const char* description) {
+  return diagnostic_context(description)
+      .with("T", type_name)
+      .with("memory_order", memory_order_name)
+      .with("memory_scope", memory_scope_name)
+      .with("address_space", address_space_name);
+}
+
+/**
+ * @brief Function helps to get the diagnostic context with the same text as
+ * get_section_name(), which is rendered only if reported by DEFERRED_INFO()
+ *
+ * @param type_name String with name of the testing type
+ * @param memory_order_name String with name of the testing memory_order
+ * @param memory_scope_name String with name of the testing memory_scope
+ * @param address_space String with name of the address_space
+ * @param memory_order sycl::memory_order which will be used as parameter of
+ * atomic_ref method
+ * @param memory_scope sycl::memory_scope which will be used as parameter of
+ * atomic_ref method
+ * @param description String with human-readable description of the test
+ * @return diagnostic_context Context referencing the given strings
+ */
+inline diagnostic_context get_diagnostic_context(
+    const std::string& type_name, const std::string& memory_order_name,
+    const std::string& memory_scope_name, const std::string& address_space_name,
+    const sycl::memory_order& memory_order,
+    const sycl::memory_scope& memory_scope, const char* description) {
+  return diagnostic_context(description)
+      .with("T", type_name)
+      .with("memory_order", memory_order_name)
+      .with("memory_scope", memory_scope_name)
+      .with("address_space", address_space_name)
+      .with("memory_order arg", memory_order)
+      .with("memory_scope arg", memory_scope);
+}
+
 /**
  * @brief Factory function for getting type_pack with fp64 type
  */
@@ -245,21 +298,15 @@ inline auto get_address_spaces() {
 
 inline bool memory_order_is_supported(sycl::queue& q,
                                       sycl::memory_order order) {
-  std::vector<sycl::memory_order> memory_orders_supported =
-      q.get_device()
-          .get_info<sycl::info::device::atomic_memory_order_capabilities>();
-  auto it = std::find(memory_orders_supported.begin(),
-                      memory_orders_supported.end(), order);
-  return it != memory_orders_supported.end();
+  return util::get<util::device_manager>()
+      .get_capabilities(q.get_device())
+      .supports(order);
 }
 
 inline bool memory_scope_is_suppoted(sycl::queue& q, sycl::memory_scope scope) {
-  std::vector<sycl::memory_scope> memory_scopes_supported =
-      q.get_device()
-          .get_info<sycl::info::device::atomic_memory_scope_capabilities>();
-  auto it = std::find(memory_scopes_supported.begin(),
-                      memory_scopes_supported.end(), scope);
-  return it != memory_scopes_supported.end();
+  return util::get<util::device_manager>()
+      .get_capabilities(q.get_device())
+      .supports(scope);
 }
 
 inline bool memory_order_and_scope_are_supported(sycl::queue& q,
@@ -288,8 +335,9 @@ bool compare_floats(T actual, T expected) {
 }
 
 inline bool device_has_not_aspect_atomic64() {
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  return !queue.get_device().has(sycl::aspect::atomic64);
+  return !sycl_cts::util::get<sycl_cts::util::device_manager>()
+              .get_capabilities()
+              .has(sycl::aspect::atomic64);
 }
 
 template <typename T, typename = std::enable_if_t<std::is_pointer_v<T>>>
@@ -180,7 +180,7 @@ class atomic_ref_compare_exchange_test
   };
 
   std::string checked_method_name;
-  std::string test_description;
+  diagnostic_context test_description;
   sycl::memory_order memory_order_read_write;
   sycl::memory_order memory_order_read;
   sycl::memory_scope memory_scope_val;
@@ -228,9 +228,9 @@ void atomic_ref_compare_exchange_test<
                                   const std::string& address_space,
                                   sycl::memory_order memory_order_val,
                                   sycl::memory_scope memory_scope_val) {
-  test_description =
-      get_section_name(type_name, memory_order, memory_scope, address_space,
-                       memory_order_val, memory_scope_val, checked_method_name);
+  test_description = get_diagnostic_context(
+      type_name, memory_order, memory_scope, address_space, memory_order_val,
+      memory_scope_val, checked_method_name.c_str());
   memory_order_read_write = memory_order_val;
   memory_order_read = memory_order_val == sycl::memory_order::acq_rel
                           ? sycl::memory_order::acquire
@@ -267,26 +267,25 @@ void atomic_ref_compare_exchange_test<ExchangeType, T, MemoryOrderT,
                                       MemoryScopeT, AddressSpaceT>::
     check_comp_exch_result_for_eq_vals(std::array<bool, 4>& result) {
   {
-    INFO(test_description + "\ncompare_exchange call failed");
-    CHECK(result[0]);
+    DEFERRED_INFO(test_description, "compare_exchange call failed");
+    DEFERRED_CHECK(result[0]);
   }
   {
-    INFO(test_description + "\ncompare_exchange_overloaded call failed");
-    CHECK(result[1]);
+    DEFERRED_INFO(test_description, "compare_exchange_overloaded call failed");
+    DEFERRED_CHECK(result[1]);
   }
   if constexpr (std::is_same_v<ExchangeType, strong>) {
     {
-      INFO(test_description +
-           "\nError, referenced value is not updated after compare_exchange "
-           "call "
-           "with equal values");
-      CHECK(result[2]);
+      DEFERRED_INFO(test_description,
+                    "Error, referenced value is not updated after "
+                    "compare_exchange call with equal values");
+      DEFERRED_CHECK(result[2]);
     }
     {
-      INFO(test_description +
-           "\nError, referenced value is not updated after "
-           "compare_exchange_overloaded call with equal values");
-      CHECK(result[3]);
+      DEFERRED_INFO(test_description,
+                    "Error, referenced value is not updated after "
+                    "compare_exchange_overloaded call with equal values");
+      DEFERRED_CHECK(result[3]);
     }
   }
 }
@@ -318,37 +317,38 @@ void atomic_ref_compare_exchange_test<ExchangeType, T, MemoryOrderT,
                                       MemoryScopeT, AddressSpaceT>::
     check_comp_exch_result_for_uneq_vals(std::array<bool, 6>& result) {
   {
-    INFO(test_description +
-         "\nError, compare_exchange call with uneq values updated "
-         "referenced value");
-    CHECK(result[0]);
+    DEFERRED_INFO(test_description,
+                  "Error, compare_exchange call with uneq values updated "
+                  "referenced value");
+    DEFERRED_CHECK(result[0]);
   }
   {
-    INFO(test_description +
-         "\nError, \"expected\" argument value is not updated after "
-         "compare_exchange call with uneq values");
-    CHECK(result[1]);
+    DEFERRED_INFO(test_description,
+                  "Error, \"expected\" argument value is not updated after "
+                  "compare_exchange call with uneq values");
+    DEFERRED_CHECK(result[1]);
   }
   {
-    INFO(test_description +
-         "\nError, compare_exchange_overloaded call with uneq values"
-         " updated referenced value");
-    CHECK(result[2]);
+    DEFERRED_INFO(test_description,
+                  "Error, compare_exchange_overloaded call with uneq values "
+                  "updated referenced value");
+    DEFERRED_CHECK(result[2]);
   }
   {
-    INFO(test_description +
-         "\nError, \"expected\" argument value is not updated after "
-         "compare_exchange_overloaded call with uneq values");
-    CHECK(result[3]);
+    DEFERRED_INFO(test_description,
+                  "Error, \"expected\" argument value is not updated after "
+                  "compare_exchange_overloaded call with uneq values");
+    DEFERRED_CHECK(result[3]);
   }
   {
-    INFO(test_description + "\nError returned type for compare_exchange()");
-    CHECK(result[4]);
+    DEFERRED_INFO(test_description,
+                  "Error returned type for compare_exchange()");
+    DEFERRED_CHECK(result[4]);
   }
   {
-    INFO(test_description +
-         "\nError returned type for compare_exchange_overloaded()");
-    CHECK(result[5]);
+    DEFERRED_INFO(test_description,
+                  "Error returned type for compare_exchange_overloaded()");
+    DEFERRED_CHECK(result[5]);
   }
 }
 
@@ -39,8 +39,9 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref compare_exchange_strong()/compare_exchange_weak() test. "
  "atomic64 types",
  "[atomic_ref]")({
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64)) {
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64)) {
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -53,9 +54,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref compare_exchange_strong()/compare_exchange_weak() test. "
  "double type",
  "[atomic_ref]")({
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  if (!queue.get_device().has(sycl::aspect::fp64) or
-      !queue.get_device().has(sycl::aspect::atomic64)) {
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::fp64) or
+      !capabilities.has(sycl::aspect::atomic64)) {
     SKIP(
         "Device does not support fp64 or atomic64 operations. "
         "Skipping the test case for double type.");
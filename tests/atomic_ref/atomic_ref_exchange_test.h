@@ -39,13 +39,13 @@ class atomic_ref_exchange_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         memory_order_val, memory_scope_val,
-                         "Check if exchange() method replaces the value of "
-                         "the object referenced by this atomic_ref with"
-                         " value operand and returns the original value of "
-                         "the referenced object in device code");
+    const auto description = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space, memory_order_val,
+        memory_scope_val,
+        "Check if exchange() method replaces the value of "
+        "the object referenced by this atomic_ref with"
+        " value operand and returns the original value of "
+        "the referenced object in device code");
     auto exchange_test = [memory_order_val, memory_scope_val](
                              T val_expd, T val_chgd,
                              typename base::atomic_ref_type& a_r,
@@ -62,17 +62,17 @@ class atomic_ref_exchange_test
       std::array result{false, false, false};
       this->queue_submit_global_scope(result, exchange_test);
       {
-        INFO(description + "\nCheck returned val (global space)");
-        CHECK(result[0]);
+        DEFERRED_INFO(description, "Check returned val (global space)");
+        DEFERRED_CHECK(result[0]);
       }
       {
-        INFO(description +
-             "\nCheck that referenced val is updated (global space)");
-        CHECK(result[1]);
+        DEFERRED_INFO(description,
+                      "Check that referenced val is updated (global space)");
+        DEFERRED_CHECK(result[1]);
       }
       {
-        INFO(description + "\nError returned type (global space)");
-        CHECK(result[2]);
+        DEFERRED_INFO(description, "Error returned type (global space)");
+        DEFERRED_CHECK(result[2]);
       }
     }
 
@@ -80,17 +80,17 @@ class atomic_ref_exchange_test
       std::array result{false, false, false};
       this->queue_submit_local_scope(result, exchange_test);
       {
-        INFO(description + "\nCheck returned val (local space)");
-        CHECK(result[0]);
+        DEFERRED_INFO(description, "Check returned val (local space)");
+        DEFERRED_CHECK(result[0]);
       }
       {
-        INFO(description +
-             "\nCheck that referenced val is updated (local space)");
-        CHECK(result[1]);
+        DEFERRED_INFO(description,
+                      "Check that referenced val is updated (local space)");
+        DEFERRED_CHECK(result[1]);
       }
       {
-        INFO(description + "\nError returned type (local space)");
-        CHECK(result[2]);
+        DEFERRED_INFO(description, "Error returned type (local space)");
+        DEFERRED_CHECK(result[2]);
       }
     }
   }
@@ -37,8 +37,9 @@ namespace atomic_ref::tests::api::core::atomic64 {
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref fetch_add()/fetch_sub() test. atomic64 types",
  "[atomic_ref]")({
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64)) {
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64)) {
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -50,9 +51,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref fetch_add()/fetch_sub() test. double type", "[atomic_ref]")({
-  auto queue = sycl_cts::util::get_cts_object::queue();
-  if (!queue.get_device().has(sycl::aspect::fp64) or
-      !queue.get_device().has(sycl::aspect::atomic64)) {
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::fp64) or
+      !capabilities.has(sycl::aspect::atomic64)) {
     SKIP(
         "Device does not support fp64 or atomic64 operations. "
         "Skipping the test case for double type.");
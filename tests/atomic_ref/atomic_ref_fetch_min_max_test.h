@@ -34,67 +34,65 @@ class atomic_ref_fetch_min_max_test
   T small_value;
 
   void check_test_result_buffer(std::array<bool, 10>& result,
-                                const std::string& description,
+                                const diagnostic_context& description,
                                 std::string addr_space) {
     {
-      INFO(description + "\nError returned val for fetch_max (" + addr_space +
-           "space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "Error returned val for fetch_max (",
+                    addr_space, "space)");
+      DEFERRED_CHECK(result[0]);
     }
     {
-      INFO(description +
-           "\nError, referenced val is not updated after fetch_max (" +
-           addr_space + " space)");
-      CHECK(result[1]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after fetch_max (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[1]);
     }
     {
-      INFO(description + "\nError returned val for fetch_min (" + addr_space +
-           " space)");
-      CHECK(result[2]);
+      DEFERRED_INFO(description, "Error returned val for fetch_min (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[2]);
     }
     {
-      INFO(description +
-           "\nError, referenced val is not updated after fetch_min (" +
-           addr_space + " space)");
-      CHECK(result[3]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is not updated after fetch_min (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[3]);
     }
     {
-      INFO(description +
-           "\nError returned val for fetch_min with operand value grater than "
-           "referenced val (" +
-           addr_space + " space)");
-      CHECK(result[4]);
+      DEFERRED_INFO(description,
+                    "Error returned val for fetch_min with operand value "
+                    "grater than referenced val (", addr_space, " space)");
+      DEFERRED_CHECK(result[4]);
     }
     {
-      INFO(description +
-           "\nError, referenced val is updated after fetch_min with "
-           "operand value grater than referenced val (" +
-           addr_space + " space)");
-      CHECK(result[5]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is updated after fetch_min with "
+                    "operand value grater than referenced val (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[5]);
     }
     {
-      INFO(description +
-           "\nError returned val for fetch_max with operand value less than "
-           "referenced val (" +
-           addr_space + " space)");
-      CHECK(result[6]);
+      DEFERRED_INFO(description,
+                    "Error returned val for fetch_max with operand value less "
+                    "than referenced val (", addr_space, " space)");
+      DEFERRED_CHECK(result[6]);
     }
     {
-      INFO(description +
-           "\nError, referenced val is updated after fetch_max with "
-           "operand value less than referenced val (" +
-           addr_space + " space)");
-      CHECK(result[7]);
+      DEFERRED_INFO(description,
+                    "Error, referenced val is updated after fetch_max with "
+                    "operand value less than referenced val (", addr_space,
+                    " space)");
+      DEFERRED_CHECK(result[7]);
     }
     {
-      INFO(description + "\nError returned type for fetch_max() (" +
-           addr_space + " space)");
-      CHECK(result[8]);
+      DEFERRED_INFO(description, "Error returned type for fetch_max() (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[8]);
     }
     {
-      INFO(description + "\nError returned type for fetch_min() (" +
-           addr_space + " space)");
-      CHECK(result[9]);
+      DEFERRED_INFO(description, "Error returned type for fetch_min() (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[9]);
     }
   }
 
@@ -120,15 +118,15 @@ class atomic_ref_fetch_min_max_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         memory_order_val, memory_scope_val,
-                         "Check if fetch_min()/fetch_max() method compute "
-                         "minimum or maximum of operand"
-                         " and the value of the referenced object, assign "
-                         "result to the referenced object"
-                         " and returns the original value of "
-                         " the referenced object in device code");
+    const auto description = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space, memory_order_val,
+        memory_scope_val,
+        "Check if fetch_min()/fetch_max() method compute "
+        "minimum or maximum of operand"
+        " and the value of the referenced object, assign "
+        "result to the referenced object"
+        " and returns the original value of "
+        " the referenced object in device code");
     T big_value_copy = big_value;
     T small_value_copy = small_value;
     auto fetch_min_max_test = [memory_order_val, memory_scope_val,
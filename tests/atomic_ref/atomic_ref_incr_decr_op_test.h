@@ -33,71 +33,71 @@ class atomic_ref_incr_decr_op_test
   using base = atomic_ref_test<T, MemoryOrderT, MemoryScopeT, AddressSpaceT>;
 
   void check_test_result_buffer(std::array<bool, 12>& result,
-                                const std::string& description,
+                                const diagnostic_context& description,
                                 std::string addr_space) {
     {
-      INFO(description + "\nError returned val for post incr op (" +
-           addr_space + " space)");
-      CHECK(result[0]);
+      DEFERRED_INFO(description, "Error returned val for post incr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[0]);
     }
     {
-      INFO(description +
-           "\nReferenced val is not updated after post incr op (" + addr_space +
-           " space)");
-      CHECK(result[1]);
+      DEFERRED_INFO(description,
+                    "Referenced val is not updated after post incr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[1]);
     }
     {
-      INFO(description + "\nError returned val for prfx incr op (" +
-           addr_space + " space)");
-      CHECK(result[2]);
+      DEFERRED_INFO(description, "Error returned val for prfx incr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[2]);
     }
     {
-      INFO(description +
-           "\nReferenced val is not updated after prfx incr op (" + addr_space +
-           " space)");
-      CHECK(result[3]);
+      DEFERRED_INFO(description,
+                    "Referenced val is not updated after prfx incr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[3]);
     }
     {
-      INFO(description + "\nError returned val for post decr op (" +
-           addr_space + " space)");
-      CHECK(result[4]);
+      DEFERRED_INFO(description, "Error returned val for post decr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[4]);
     }
     {
-      INFO(description +
-           "\nReferenced val is not updated after post decr op (" + addr_space +
-           " space)");
-      CHECK(result[5]);
+      DEFERRED_INFO(description,
+                    "Referenced val is not updated after post decr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[5]);
     }
     {
-      INFO(description + "\nError returned val for prfx decr op (" +
-           addr_space + " space)");
-      CHECK(result[6]);
+      DEFERRED_INFO(description, "Error returned val for prfx decr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[6]);
     }
     {
-      INFO(description +
-           "\nReferenced val is not updated after prfx decr op (" + addr_space +
-           " space)");
-      CHECK(result[7]);
+      DEFERRED_INFO(description,
+                    "Referenced val is not updated after prfx decr op (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[7]);
     }
     {
-      INFO(description + "\nError returned type for postfix ++ (" + addr_space +
-           " space)");
-      CHECK(result[8]);
+      DEFERRED_INFO(description, "Error returned type for postfix ++ (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[8]);
     }
     {
-      INFO(description + "\nError returned type for prefix ++ (" + addr_space +
-           " space)");
-      CHECK(result[9]);
+      DEFERRED_INFO(description, "Error returned type for prefix ++ (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[9]);
     }
     {
-      INFO(description + "\nError returned type for postfix -- (" + addr_space +
-           " space)");
-      CHECK(result[10]);
+      DEFERRED_INFO(description, "Error returned type for postfix -- (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[10]);
     }
     {
-      INFO(description + "\nError returned type for prefix -- (" + addr_space +
-           " space)");
-      CHECK(result[11]);
+      DEFERRED_INFO(description, "Error returned type for prefix -- (",
+                    addr_space, " space)");
+      DEFERRED_CHECK(result[11]);
     }
   }
 
@@ -109,9 +109,9 @@ class atomic_ref_incr_decr_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         "Check increment/decrement operators in device code");
+    const auto description = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space,
+        "Check increment/decrement operators in device code");
     auto incr_op_test = [](T val_expd, T val_chgd,
                            typename base::atomic_ref_type& a_r, auto result_acc,
                            auto ref_data_acc) {
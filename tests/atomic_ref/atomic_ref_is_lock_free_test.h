@@ -39,9 +39,9 @@ class atomic_ref_is_lock_free_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         "Check is_lock_free() method");
+    const auto description = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space,
+        "Check is_lock_free() method");
     auto is_lock_free_test = [](T val_expd, T val_chgd,
                                 typename base::atomic_ref_type& a_r,
                                 auto result_acc, auto ref_data_acc) {
@@ -55,22 +55,22 @@ class atomic_ref_is_lock_free_test
       std::array result{false, false};
       this->queue_submit_global_scope(result, is_lock_free_test);
       if constexpr (base::atomic_ref_type::is_always_lock_free == true) {
-        INFO(description + " (global space)" + "\nError returned value");
-        CHECK(result[0]);
+        DEFERRED_INFO(description, "(global space)\nError returned value");
+        DEFERRED_CHECK(result[0]);
       }
-      INFO(description + " (global space)" + "\nError returned type");
-      CHECK(result[1]);
+      DEFERRED_INFO(description, "(global space)\nError returned type");
+      DEFERRED_CHECK(result[1]);
     }
 
     if constexpr (base::address_space_is_not_global_space()) {
       std::array result{false, false};
       this->queue_submit_local_scope(result, is_lock_free_test);
       if constexpr (base::atomic_ref_type::is_always_lock_free == true) {
-        INFO(description + " (local space)" + "\nError returned value");
-        CHECK(result[0]);
+        DEFERRED_INFO(description, "(local space)\nError returned value");
+        DEFERRED_CHECK(result[0]);
       }
-      INFO(description + " (local space)" + "\nError returned type");
-      CHECK(result[1]);
+      DEFERRED_INFO(description, "(local space)\nError returned type");
+      DEFERRED_CHECK(result[1]);
     }
   }
 
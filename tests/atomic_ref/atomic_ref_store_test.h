@@ -39,11 +39,11 @@ class atomic_ref_store_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string desription =
-        get_section_name(type_name, memory_order, memory_scope, address_space,
-                         memory_order_val, memory_scope_val,
-                         "Check if store() method stores operand to the object"
-                         " referenced by this atomic_ref in device code");
+    const auto desription = get_diagnostic_context(
+        type_name, memory_order, memory_scope, address_space, memory_order_val,
+        memory_scope_val,
+        "Check if store() method stores operand to the object"
+        " referenced by this atomic_ref in device code");
     memory_order_val = memory_order_val == sycl::memory_order::acq_rel
                            ? sycl::memory_order::release
                            : memory_order_val;
@@ -58,15 +58,15 @@ class atomic_ref_store_test
     if constexpr (base::address_space_is_not_local_space()) {
       std::array result{false};
       this->queue_submit_global_scope(result, store_test);
-      INFO(desription + " (global space");
-      CHECK(result[0]);
+      DEFERRED_INFO(desription, "(global space)");
+      DEFERRED_CHECK(result[0]);
     }
 
     if constexpr (base::address_space_is_not_global_space()) {
       std::array result{false};
       this->queue_submit_local_scope(result, store_test);
-      INFO(desription + " (local space");
-      CHECK(result[0]);
+      DEFERRED_INFO(desription, "(local space)");
+      DEFERRED_CHECK(result[0]);
     }
   }
 
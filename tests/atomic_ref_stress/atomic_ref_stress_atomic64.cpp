@@ -33,8 +33,9 @@ namespace atomic_ref_stress_test_atomic64 {
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref atomicity for device scope test. long long type",
  "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -45,12 +46,13 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref atomicity for device scope test. double type",
  "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::fp64))
+  if (!capabilities.has(sycl::aspect::fp64))
     SKIP(
         "Device does not support fp64 operations. "
         "Skipping the test case.");
@@ -61,8 +63,9 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref atomicity for work_group scope test. long long type",
  "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -74,12 +77,13 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref atomicity for work_group scope test. double type",
  "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::fp64))
+  if (!capabilities.has(sycl::aspect::fp64))
     SKIP(
         "Device does not support fp64 operations. "
         "Skipping the test case.");
@@ -89,8 +93,9 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref aquire and release. long long type", "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -100,12 +105,13 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref aquire and release. double types", "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::fp64))
+  if (!capabilities.has(sycl::aspect::fp64))
     SKIP(
         "Device does not support fp64 operations. "
         "Skipping the test case.");
@@ -115,8 +121,9 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref ordering. long long type", "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
@@ -126,12 +133,13 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("sycl::atomic_ref ordering. double type", "[atomic_ref_stress]")({
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::fp64))
+  if (!capabilities.has(sycl::aspect::fp64))
     SKIP(
         "Device does not support fp64 operations. "
         "Skipping the test case.");
@@ -144,12 +152,13 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
  "long long type",
  "[atomic_ref_stress]")({
 #ifdef __cpp_lib_atomic_ref
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::usm_atomic_shared_allocations))
+  if (!capabilities.has(sycl::aspect::usm_atomic_shared_allocations))
     SKIP(
         "Device does not support usm_atomic_shared_allocations. "
         "Skipping the test case.");
@@ -166,16 +175,17 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
  "double type",
  "[atomic_ref_stress]")({
 #ifdef __cpp_lib_atomic_ref
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::atomic64))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
     SKIP(
         "Device does not support atomic64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::fp64))
+  if (!capabilities.has(sycl::aspect::fp64))
     SKIP(
         "Device does not support fp64 operations. "
         "Skipping the test case.");
-  if (!queue.get_device().has(sycl::aspect::usm_atomic_shared_allocations))
+  if (!capabilities.has(sycl::aspect::usm_atomic_shared_allocations))
     SKIP(
         "Device does not support usm_atomic_shared_allocations. "
         "Skipping the test case.");
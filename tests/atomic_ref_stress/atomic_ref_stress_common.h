@@ -22,6 +22,7 @@
 #define SYCL_CTS_ATOMIC_REF_STRESS_TEST_H
 
 #include "../atomic_ref/atomic_ref_common.h"
+#include "../common/diagnostic_context.h"
 #include "../common/once_per_unit.h"
 #include "../common/section_name_builder.h"
 #include "../common/type_coverage.h"
@@ -46,7 +47,7 @@ class atomicity_device_scope {
                   const std::string &memory_order_name,
                   const std::string &memory_scope_name,
                   const std::string &address_space_name) {
-    INFO(atomic_ref::tests::common::get_section_name(
+    DEFERRED_INFO(atomic_ref::tests::common::get_diagnostic_context(
         type_name, memory_order_name, memory_scope_name, address_space_name,
         "atomicity_device_scope"));
     auto queue = once_per_unit::get_queue();
@@ -73,7 +74,7 @@ class atomicity_device_scope {
       res = atomic_ref::tests::common::compare_floats<T>(val, size * 2);
     else
       res = (val == size * 2);
-    CHECK(res);
+    DEFERRED_CHECK(res);
   }
 };
 
@@ -90,7 +91,7 @@ class atomicity_work_group_scope {
                   const std::string &memory_order_name,
                   const std::string &memory_scope_name,
                   const std::string &address_space_name) {
-    INFO(atomic_ref::tests::common::get_section_name(
+    DEFERRED_INFO(atomic_ref::tests::common::get_diagnostic_context(
         type_name, memory_order_name, memory_scope_name, address_space_name,
         "atomicity_work_group_scope"));
     auto queue = once_per_unit::get_queue();
@@ -123,7 +124,7 @@ class atomicity_work_group_scope {
           })
           .wait_and_throw();
     }
-    CHECK(std::all_of(vals.cbegin(), vals.cend(), [=](T i) {
+    DEFERRED_CHECK(std::all_of(vals.cbegin(), vals.cend(), [=](T i) {
       if constexpr (std::is_floating_point_v<T>)
         return atomic_ref::tests::common::compare_floats(i,
                                                          -T(local_range * 2));
@@ -146,7 +147,7 @@ class aquire_release {
                   const std::string &memory_order_name,
                   const std::string &memory_scope_name,
                   const std::string &address_space_name) {
-    INFO(atomic_ref::tests::common::get_section_name(
+    DEFERRED_INFO(atomic_ref::tests::common::get_diagnostic_context(
         type_name, memory_order_name, memory_scope_name, address_space_name,
         "aquire_release"));
     auto queue = once_per_unit::get_queue();
@@ -185,7 +186,8 @@ class aquire_release {
         });
       });
     }
-    CHECK(std::all_of(res.cbegin(), res.cend(), [=](T i) { return i; }));
+    DEFERRED_CHECK(
+        std::all_of(res.cbegin(), res.cend(), [=](T i) { return i; }));
   }
 };
 
@@ -206,7 +208,7 @@ class ordering {
                   const std::string &memory_order_name,
                   const std::string &memory_scope_name,
                   const std::string &address_space_name) {
-    INFO(atomic_ref::tests::common::get_section_name(
+    DEFERRED_INFO(atomic_ref::tests::common::get_diagnostic_context(
         type_name, memory_order_name, memory_scope_name, address_space_name,
         "ordering"));
     auto queue = once_per_unit::get_queue();
@@ -242,7 +244,8 @@ class ordering {
         });
       });
     }
-    CHECK(std::all_of(res.cbegin(), res.cend(), [=](T i) { return i; }));
+    DEFERRED_CHECK(
+        std::all_of(res.cbegin(), res.cend(), [=](T i) { return i; }));
   }
 };
 #ifdef __cpp_lib_atomic_ref
@@ -257,7 +260,7 @@ class atomicity_with_host_code {
                   const std::string& memory_order_name,
                   const std::string& memory_scope_name,
                   const std::string& address_space_name) {
-    INFO(atomic_ref::tests::common::get_section_name(
+    DEFERRED_INFO(atomic_ref::tests::common::get_diagnostic_context(
         type_name, memory_order_name, memory_scope_name, address_space_name,
         "atomicity_with_host_code"));
     auto queue = once_per_unit::get_queue();
@@ -283,7 +286,7 @@ class atomicity_with_host_code {
     });
     for (int i = 0; i < count; i++) a_host++;
     event.wait();
-    CHECK(*pval == size + count);
+    DEFERRED_CHECK(*pval == size + count);
   }
 };
 #endif
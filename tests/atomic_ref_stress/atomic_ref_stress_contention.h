@@ -0,0 +1,334 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides the sweep of the contention on sycl::atomic_ref counters
+//
+*******************************************************************************/
+#ifndef SYCL_CTS_ATOMIC_REF_STRESS_CONTENTION_H
+#define SYCL_CTS_ATOMIC_REF_STRESS_CONTENTION_H
+
+#include "../common/benchmark.h"
+#include "atomic_ref_stress_common.h"
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace atomic_ref_stress_test::contention {
+using namespace sycl_cts;
+
+// Number of atomic operations performed by every work-item
+constexpr size_t ops_per_item = 64;
+
+// The bounds of the work-group size and of the number of work-groups keep
+// the totals exactly representable by float
+constexpr size_t max_local_range = 256;
+constexpr size_t max_group_count = 64;
+
+// Distance in bytes between the counters of the spread layout, at least the
+// size of a cache line on the common devices
+constexpr size_t cache_line_size = 64;
+
+enum class operation { fetch_add, compare_exchange_loop, exchange };
+
+inline std::string to_string(operation op) {
+  switch (op) {
+    case operation::fetch_add:
+      return "fetch_add";
+    case operation::compare_exchange_loop:
+      return "compare_exchange_strong loop";
+    case operation::exchange:
+      return "exchange";
+  }
+  return "unknown";
+}
+
+enum class layout { packed, spread };
+
+/**
+ * @brief Returns the distance between the counters in elements
+ */
+template <typename T>
+size_t get_stride(layout counterLayout) {
+  return counterLayout == layout::packed
+             ? 1
+             : std::max<size_t>(1, cache_line_size / sizeof(T));
+}
+
+/**
+ * @brief Returns the largest power of two work-group size within the bounds
+ */
+inline size_t get_local_range(const sycl::queue& queue) {
+  const size_t limit = std::min<size_t>(
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>(),
+      max_local_range);
+  size_t localRange = 1;
+  while (localRange * 2 <= limit) localRange *= 2;
+  return localRange;
+}
+
+inline size_t get_group_count(const sycl::queue& queue) {
+  return std::clamp<size_t>(
+      queue.get_device().get_info<sycl::info::device::max_compute_units>(), 1,
+      max_group_count);
+}
+
+/**
+ * @brief Performs ops_per_item operations on the counter, the exchange
+ *        accumulates the previous values of the counter
+ */
+template <operation Op, typename AtomicRefT, typename T>
+void run_operations(AtomicRefT ref, T& exchanged) {
+  for (size_t i = 0; i < ops_per_item; ++i) {
+    if constexpr (Op == operation::fetch_add) {
+      ref.fetch_add(T(1));
+    } else if constexpr (Op == operation::compare_exchange_loop) {
+      T expected = ref.load();
+      while (!ref.compare_exchange_strong(expected, expected + T(1))) {
+      }
+    } else {
+      exchanged += ref.exchange(T(1));
+    }
+  }
+}
+
+/**
+ * @brief Measures the throughput of the operations on 1, 2, 4 ... counters,
+ *        up to one counter per work-item of a work-group, packed and spread
+ *        across cache lines
+ *
+ * Work-item i operates on the counter i % counters, so the neighboring
+ * work-items never share a counter unless there is a single one. The
+ * work_group scope places the counters in local memory, one set per
+ * work-group, the other scopes place them in global memory.
+ */
+template <typename T, typename MemoryOrderT, typename MemoryScopeT,
+          typename AddressSpaceT>
+class contention_sweep {
+  static constexpr sycl::memory_order MemoryOrder = MemoryOrderT::value;
+  static constexpr sycl::memory_scope MemoryScope = MemoryScopeT::value;
+  static constexpr sycl::access::address_space AddressSpace =
+      AddressSpaceT::value;
+  static constexpr bool in_local_memory =
+      MemoryScope == sycl::memory_scope::work_group;
+
+  using atomic_ref_t =
+      sycl::atomic_ref<T, MemoryOrder, MemoryScope, AddressSpace>;
+
+ public:
+  void operator()(const std::string& type_name,
+                  const std::string& memory_order_name,
+                  const std::string& memory_scope_name,
+                  const std::string& address_space_name) {
+    auto queue = once_per_unit::get_queue();
+    if (!atomic_ref::tests::common::memory_order_and_scope_are_supported(
+            queue, MemoryOrder, MemoryScope))
+      return;
+    run<operation::fetch_add>(queue, type_name, memory_order_name,
+                              memory_scope_name, address_space_name);
+    run<operation::compare_exchange_loop>(queue, type_name, memory_order_name,
+                                          memory_scope_name,
+                                          address_space_name);
+    run<operation::exchange>(queue, type_name, memory_order_name,
+                             memory_scope_name, address_space_name);
+  }
+
+ private:
+  template <operation Op>
+  void run(sycl::queue& queue, const std::string& type_name,
+           const std::string& memory_order_name,
+           const std::string& memory_scope_name,
+           const std::string& address_space_name) {
+    const auto name = atomic_ref::tests::common::get_section_name(
+        type_name, memory_order_name, memory_scope_name, address_space_name,
+        "contention sweep of " + to_string(Op));
+    INFO(name);
+    const size_t localRange = get_local_range(queue);
+    const size_t groupCount = get_group_count(queue);
+    const size_t items = localRange * groupCount;
+
+    benchmark::table results(name, {"packed", "spread"}, "Mops/s");
+    for (size_t counters = 1; counters <= localRange; counters *= 2) {
+      std::vector<double> row;
+      for (auto counterLayout : {layout::packed, layout::spread}) {
+        const auto seconds = measure<Op>(queue, counters,
+                                         get_stride<T>(counterLayout),
+                                         localRange, groupCount);
+        row.push_back(seconds > 0 ? items * ops_per_item / seconds / 1e6
+                                  : 0.0);
+      }
+      results.add_row(
+          std::to_string(counters) + (counters == 1 ? " counter" : " counters"),
+          row);
+    }
+    results.print();
+  }
+
+  /**
+   * @brief Runs the operations twice, verifies both runs and returns the
+   *        wall time of the second one in seconds
+   */
+  template <operation Op>
+  double measure(sycl::queue& queue, size_t counters, size_t stride,
+                 size_t localRange, size_t groupCount) {
+    const size_t items = localRange * groupCount;
+    // Values of the counters after the run, one set per work-group when in
+    // local memory
+    const size_t resultCount =
+        in_local_memory ? counters * groupCount : counters * stride;
+    sycl::buffer<T, 1> counterBuf{sycl::range<1>(resultCount)};
+    sycl::buffer<T, 1> exchangedBuf{sycl::range<1>(items)};
+
+    const auto run_once = [&] {
+      if constexpr (!in_local_memory) {
+        queue
+            .submit([&](sycl::handler& cgh) {
+              sycl::accessor acc{counterBuf, cgh, sycl::write_only,
+                                 sycl::no_init};
+              cgh.fill(acc, T(0));
+            })
+            .wait_and_throw();
+      }
+      const auto time = benchmark::time_call([&] {
+        submit<Op>(queue, counterBuf, exchangedBuf, counters, stride,
+                   localRange, groupCount)
+            .wait_and_throw();
+      });
+      verify<Op>(counterBuf, exchangedBuf, counters, stride, localRange,
+                 groupCount);
+      return time;
+    };
+    run_once();
+    return run_once().count();
+  }
+
+  template <operation Op>
+  sycl::event submit(sycl::queue& queue, sycl::buffer<T, 1>& counterBuf,
+                     sycl::buffer<T, 1>& exchangedBuf, size_t counters,
+                     size_t stride, size_t localRange, size_t groupCount) {
+    const sycl::nd_range<1> range{sycl::range<1>(localRange * groupCount),
+                                  sycl::range<1>(localRange)};
+    return queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor exchangedAcc{exchangedBuf, cgh, sycl::write_only,
+                                  sycl::no_init};
+      if constexpr (in_local_memory) {
+        sycl::accessor resultAcc{counterBuf, cgh, sycl::write_only,
+                                 sycl::no_init};
+        sycl::local_accessor<T> localAcc{sycl::range<1>(counters * stride),
+                                         cgh};
+        cgh.parallel_for(range, [=](sycl::nd_item<1> item) {
+          const size_t lid = item.get_local_linear_id();
+          for (size_t i = lid; i < counters * stride; i += localRange) {
+            localAcc[i] = T(0);
+          }
+          sycl::group_barrier(item.get_group());
+          T exchanged{0};
+          run_operations<Op>(atomic_ref_t{localAcc[(lid % counters) * stride]},
+                             exchanged);
+          sycl::group_barrier(item.get_group());
+          if (lid < counters) {
+            resultAcc[item.get_group_linear_id() * counters + lid] =
+                localAcc[lid * stride];
+          }
+          exchangedAcc[item.get_global_linear_id()] = exchanged;
+        });
+      } else {
+        sycl::accessor counterAcc{counterBuf, cgh, sycl::read_write};
+        cgh.parallel_for(range, [=](sycl::nd_item<1> item) {
+          const size_t id = item.get_global_linear_id();
+          T exchanged{0};
+          run_operations<Op>(atomic_ref_t{counterAcc[(id % counters) * stride]},
+                             exchanged);
+          exchangedAcc[id] = exchanged;
+        });
+      }
+    });
+  }
+
+  /**
+   * @brief Checks the final values of the counters. Each counter receives
+   *        the operations of the same number of work-items. An exchange
+   *        returns every value written before exactly once, so the returned
+   *        values and the final values add up to the number of operations.
+   */
+  template <operation Op>
+  void verify(sycl::buffer<T, 1>& counterBuf, sycl::buffer<T, 1>& exchangedBuf,
+              size_t counters, size_t stride, size_t localRange,
+              size_t groupCount) {
+    sycl::host_accessor counterAcc{counterBuf, sycl::read_only};
+    sycl::host_accessor exchangedAcc{exchangedBuf, sycl::read_only};
+    const size_t items = localRange * groupCount;
+    const size_t sets = in_local_memory ? groupCount : 1;
+    const size_t itemsPerSet = items / sets;
+
+    bool correct = true;
+    double total = 0;
+    for (size_t set = 0; set < sets; ++set) {
+      for (size_t counter = 0; counter < counters; ++counter) {
+        const T value = in_local_memory
+                            ? counterAcc[set * counters + counter]
+                            : counterAcc[counter * stride];
+        const T expected = Op == operation::exchange
+                               ? T(1)
+                               : T(itemsPerSet / counters * ops_per_item);
+        correct = correct && value == expected;
+        total += static_cast<double>(value);
+      }
+    }
+    if constexpr (Op == operation::exchange) {
+      for (size_t i = 0; i < items; ++i) {
+        total += static_cast<double>(exchangedAcc[i]);
+      }
+      correct = correct && total == static_cast<double>(items * ops_per_item);
+    }
+    INFO(counters << " counter(s) with a stride of " << stride
+                  << " element(s)");
+    CHECK(correct);
+  }
+};
+
+template <typename T>
+struct run_contention_sweep {
+  void operator()(const std::string& type_name) {
+    const auto memory_orders =
+        value_pack<sycl::memory_order, sycl::memory_order::relaxed,
+                   sycl::memory_order::acq_rel,
+                   sycl::memory_order::seq_cst>::generate_named();
+    const auto global_memory_scopes =
+        value_pack<sycl::memory_scope, sycl::memory_scope::device,
+                   sycl::memory_scope::system>::generate_named();
+    const auto global_address_spaces = value_pack<
+        sycl::access::address_space, sycl::access::address_space::global_space,
+        sycl::access::address_space::generic_space>::generate_named();
+    const auto local_memory_scopes =
+        value_pack<sycl::memory_scope,
+                   sycl::memory_scope::work_group>::generate_named();
+    const auto local_address_spaces = value_pack<
+        sycl::access::address_space, sycl::access::address_space::local_space,
+        sycl::access::address_space::generic_space>::generate_named();
+
+    for_all_combinations<contention_sweep, T>(
+        memory_orders, global_memory_scopes, global_address_spaces, type_name);
+    for_all_combinations<contention_sweep, T>(
+        memory_orders, local_memory_scopes, local_address_spaces, type_name);
+  }
+};
+
+}  // namespace atomic_ref_stress_test::contention
+
+#endif  // SYCL_CTS_ATOMIC_REF_STRESS_CONTENTION_H
@@ -0,0 +1,64 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/disabled_for_test_case.h"
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+#include "atomic_ref_stress_contention.h"
+#endif  // !SYCL_CTS_COMPILING_WITH_HIPSYCL
+#include <catch2/catch_test_macros.hpp>
+
+namespace atomic_ref_stress_contention_atomic64 {
+
+// FIXME: re-enable for hipsycl
+// when sycl::info::device::atomic_memory_order_capabilities and
+// sycl::info::device::atomic_memory_scope_capabilities are implemented in
+// hipsycl
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("sycl::atomic_ref contention sweep. long long type",
+ "[atomic_ref_stress][.contention]")({
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
+    SKIP(
+        "Device does not support atomic64 operations. "
+        "Skipping the test case.");
+
+  atomic_ref_stress_test::contention::run_contention_sweep<long long>{}(
+      "long long");
+});
+
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("sycl::atomic_ref contention sweep. double type",
+ "[atomic_ref_stress][.contention]")({
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::atomic64))
+    SKIP(
+        "Device does not support atomic64 operations. "
+        "Skipping the test case.");
+  if (!capabilities.has(sycl::aspect::fp64))
+    SKIP(
+        "Device does not support fp64 operations. "
+        "Skipping the test case.");
+
+  atomic_ref_stress_test::contention::run_contention_sweep<double>{}("double");
+});
+
+}  // namespace atomic_ref_stress_contention_atomic64
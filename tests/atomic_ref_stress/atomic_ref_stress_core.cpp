@@ -62,8 +62,9 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
  "core types",
  "[atomic_ref_stress]")({
 #ifdef __cpp_lib_atomic_ref
-  auto queue = once_per_unit::get_queue();
-  if (!queue.get_device().has(sycl::aspect::usm_atomic_shared_allocations))
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
+  if (!capabilities.has(sycl::aspect::usm_atomic_shared_allocations))
     SKIP(
         "Device does not support usm_atomic_shared_allocations. "
         "Skipping the test case.");
@@ -0,0 +1,378 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the bandwidth of a memory-bound kernel accessing
+//  the memory through accessors, local accessors, multi_ptr and USM pointers
+//
+*******************************************************************************/
+
+#include "../../util/usm_helper.h"
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace bench_kernel_access {
+using namespace sycl_cts;
+using namespace sycl_cts::benchmark;
+
+// All the variants run the STREAM triad a = b + scalar * c over this number of
+// elements, reshaped for the accessors with more dimensions
+constexpr size_t element_count = size_t{1} << 24;
+
+// Each element is read from b and c and written to a
+constexpr size_t bytes_per_element = 3 * sizeof(float);
+constexpr size_t total_bytes = element_count * bytes_per_element;
+
+constexpr float scalar = 3.0f;
+constexpr float input_c = 2.0f;
+
+// Number of elements preceding the ranged accessors with an offset along the
+// first dimension
+constexpr size_t padding = 16;
+
+// Largest work-group size of the local accessor variant
+constexpr size_t max_local_size = 256;
+
+inline float input_b(size_t index) { return static_cast<float>(index % 1024); }
+
+inline float expected(size_t index) {
+  return input_b(index) + scalar * input_c;
+}
+
+template <int Dims>
+sycl::range<Dims> get_shape() {
+  if constexpr (Dims == 1) {
+    return sycl::range<1>(element_count);
+  } else if constexpr (Dims == 2) {
+    return sycl::range<2>(size_t{1} << 12, size_t{1} << 12);
+  } else {
+    return sycl::range<3>(size_t{1} << 8, size_t{1} << 8, size_t{1} << 8);
+  }
+}
+
+/**
+ * @brief Reports the bandwidth of the variant and its ratio to the bandwidth
+ *        of the raw USM pointers
+ */
+class bandwidth_reporter {
+ public:
+  explicit bandwidth_reporter(const samples& rawPointers)
+      : baseline(get_bandwidth(rawPointers, total_bytes)) {
+    report_bandwidth("raw USM pointers", rawPointers, total_bytes);
+  }
+
+  void report(const std::string& name, const samples& s) const {
+    report_bandwidth(name, s, total_bytes);
+    report_measurement(name + ", relative to raw pointers",
+                       baseline > 0 ? get_bandwidth(s, total_bytes) / baseline
+                                    : 0.0,
+                       "x");
+  }
+
+ private:
+  double baseline;
+};
+
+/**
+ * @brief Collects the wall time of the submission and the completion of the
+ *        command group
+ */
+template <typename CommandGroupT>
+samples measure(sycl::queue& queue, const CommandGroupT& cgf) {
+  return collect(
+      [&] { return time_call([&] { queue.submit(cgf).wait_and_throw(); }); });
+}
+
+/**
+ * @brief Checks the first and the last elements of the result in USM memory
+ */
+void check_usm_result(sycl::queue& queue, const float* a,
+                      const std::string& name) {
+  float ends[2]{};
+  queue.memcpy(&ends[0], a, sizeof(float));
+  queue.memcpy(&ends[1], a + element_count - 1, sizeof(float));
+  queue.wait_and_throw();
+  INFO(name << ": the result is wrong");
+  CHECK(ends[0] == expected(0));
+  CHECK(ends[1] == expected(element_count - 1));
+}
+
+class usm_init_kernel;
+class raw_pointer_kernel;
+class multi_ptr_kernel;
+class local_accessor_kernel;
+
+/**
+ * @brief Device USM arrays of the triad
+ */
+struct usm_arrays {
+  using pointer_t =
+      decltype(usm_helper::allocate_usm_memory<sycl::usm::alloc::device,
+                                               float>(
+          std::declval<const sycl::queue&>()));
+
+  explicit usm_arrays(sycl::queue& queue)
+      : a(usm_helper::allocate_usm_memory<sycl::usm::alloc::device, float>(
+            queue, element_count)),
+        b(usm_helper::allocate_usm_memory<sycl::usm::alloc::device, float>(
+            queue, element_count)),
+        c(usm_helper::allocate_usm_memory<sycl::usm::alloc::device, float>(
+            queue, element_count)) {
+    float* bPtr = b.get();
+    float* cPtr = c.get();
+    queue
+        .parallel_for<usm_init_kernel>(sycl::range<1>(element_count),
+                                       [=](sycl::id<1> id) {
+                                         bPtr[id[0]] = input_b(id[0]);
+                                         cPtr[id[0]] = input_c;
+                                       })
+        .wait_and_throw();
+  }
+
+  pointer_t a;
+  pointer_t b;
+  pointer_t c;
+};
+
+samples measure_raw_pointers(sycl::queue& queue, usm_arrays& arrays) {
+  queue.memset(arrays.a.get(), 0, element_count * sizeof(float)).wait();
+  float* a = arrays.a.get();
+  const float* b = arrays.b.get();
+  const float* c = arrays.c.get();
+  const auto s = measure(queue, [&](sycl::handler& cgh) {
+    cgh.parallel_for<raw_pointer_kernel>(
+        sycl::range<1>(element_count),
+        [=](sycl::id<1> id) { a[id[0]] = b[id[0]] + scalar * c[id[0]]; });
+  });
+  check_usm_result(queue, a, "raw USM pointers");
+  return s;
+}
+
+samples measure_usm_multi_ptr(sycl::queue& queue, usm_arrays& arrays) {
+  queue.memset(arrays.a.get(), 0, element_count * sizeof(float)).wait();
+  float* a = arrays.a.get();
+  float* b = arrays.b.get();
+  float* c = arrays.c.get();
+  const auto s = measure(queue, [&](sycl::handler& cgh) {
+    cgh.parallel_for<multi_ptr_kernel>(
+        sycl::range<1>(element_count), [=](sycl::id<1> id) {
+          constexpr auto space = sycl::access::address_space::global_space;
+          constexpr auto decorated = sycl::access::decorated::yes;
+          auto aPtr = sycl::address_space_cast<space, decorated>(a);
+          auto bPtr = sycl::address_space_cast<space, decorated>(b);
+          auto cPtr = sycl::address_space_cast<space, decorated>(c);
+          aPtr[id[0]] = bPtr[id[0]] + scalar * cPtr[id[0]];
+        });
+  });
+  check_usm_result(queue, a, "USM address_space_cast multi_ptr");
+  return s;
+}
+
+/**
+ * @brief Stages the inputs of each work-group in local memory and computes
+ *        the elements of another work-item, which requires the barrier
+ */
+samples measure_local_accessor(sycl::queue& queue, usm_arrays& arrays) {
+  size_t localSize = max_local_size;
+  const size_t maxWorkGroupSize =
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+  while (localSize > maxWorkGroupSize) localSize /= 2;
+
+  queue.memset(arrays.a.get(), 0, element_count * sizeof(float)).wait();
+  float* a = arrays.a.get();
+  const float* b = arrays.b.get();
+  const float* c = arrays.c.get();
+  const auto s = measure(queue, [&](sycl::handler& cgh) {
+    sycl::local_accessor<float, 1> localB(sycl::range<1>(localSize), cgh);
+    sycl::local_accessor<float, 1> localC(sycl::range<1>(localSize), cgh);
+    cgh.parallel_for<local_accessor_kernel>(
+        sycl::nd_range<1>(sycl::range<1>(element_count),
+                          sycl::range<1>(localSize)),
+        [=](sycl::nd_item<1> item) {
+          const size_t local = item.get_local_id(0);
+          const size_t mirrored = localSize - 1 - local;
+          const size_t global = item.get_global_id(0);
+          localB[local] = b[global];
+          localC[local] = c[global];
+          sycl::group_barrier(item.get_group());
+          a[global - local + mirrored] =
+              localB[mirrored] + scalar * localC[mirrored];
+        });
+  });
+  check_usm_result(queue, a, "local_accessor");
+  return s;
+}
+
+enum class accessor_variant { whole_buffer, ranged, ranged_with_offset };
+
+std::string to_string(accessor_variant variant) {
+  switch (variant) {
+    case accessor_variant::whole_buffer:
+      return "whole buffer";
+    case accessor_variant::ranged:
+      return "ranged";
+    case accessor_variant::ranged_with_offset:
+      return "ranged with offset";
+  }
+  return "unknown";
+}
+
+template <int Dims, accessor_variant Variant>
+class accessor_init_kernel;
+template <int Dims, accessor_variant Variant>
+class accessor_kernel;
+
+/**
+ * @brief Runs the triad through accessors of given dimensionality, the
+ *        accessors with an offset access the buffers with padding
+ */
+template <int Dims, accessor_variant Variant>
+samples measure_accessor(sycl::queue& queue, const std::string& name) {
+  const auto shape = get_shape<Dims>();
+  auto bufferRange = shape;
+  sycl::id<Dims> offset;
+  if constexpr (Variant == accessor_variant::ranged_with_offset) {
+    bufferRange[0] += padding;
+    offset[0] = padding;
+  }
+  sycl::buffer<float, Dims> a(bufferRange);
+  sycl::buffer<float, Dims> b(bufferRange);
+  sycl::buffer<float, Dims> c(bufferRange);
+
+  const auto get_accessor = [&](auto& buffer, sycl::handler& cgh, auto tag) {
+    if constexpr (Variant == accessor_variant::whole_buffer) {
+      return sycl::accessor(buffer, cgh, tag);
+    } else {
+      return sycl::accessor(buffer, cgh, shape, offset, tag);
+    }
+  };
+
+  queue.submit([&](sycl::handler& cgh) {
+    auto accA = get_accessor(a, cgh, sycl::write_only);
+    auto accB = get_accessor(b, cgh, sycl::write_only);
+    auto accC = get_accessor(c, cgh, sycl::write_only);
+    cgh.parallel_for<accessor_init_kernel<Dims, Variant>>(
+        shape, [=](sycl::item<Dims> item) {
+          accA[item.get_id()] = 0.0f;
+          accB[item.get_id()] = input_b(item.get_linear_id());
+          accC[item.get_id()] = input_c;
+        });
+  });
+
+  const auto s = measure(queue, [&](sycl::handler& cgh) {
+    auto accA = get_accessor(a, cgh, sycl::write_only);
+    auto accB = get_accessor(b, cgh, sycl::read_only);
+    auto accC = get_accessor(c, cgh, sycl::read_only);
+    cgh.parallel_for<accessor_kernel<Dims, Variant>>(
+        shape,
+        [=](sycl::id<Dims> id) { accA[id] = accB[id] + scalar * accC[id]; });
+  });
+
+  sycl::host_accessor result(a, shape, offset, sycl::read_only);
+  sycl::id<Dims> last;
+  for (int i = 0; i < Dims; ++i) last[i] = shape[i] - 1;
+  INFO(name << ": the result is wrong");
+  CHECK(result[sycl::id<Dims>()] == expected(0));
+  CHECK(result[last] == expected(element_count - 1));
+  return s;
+}
+
+class accessor_multi_ptr_init_kernel;
+class accessor_multi_ptr_kernel;
+
+/**
+ * @brief Runs the triad through the multi_ptr obtained from the accessors
+ */
+samples measure_accessor_multi_ptr(sycl::queue& queue,
+                                   const std::string& name) {
+  const sycl::range<1> shape(element_count);
+  sycl::buffer<float, 1> a(shape);
+  sycl::buffer<float, 1> b(shape);
+  sycl::buffer<float, 1> c(shape);
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor accB(b, cgh, sycl::write_only);
+    sycl::accessor accC(c, cgh, sycl::write_only);
+    cgh.parallel_for<accessor_multi_ptr_init_kernel>(
+        shape, [=](sycl::id<1> id) {
+          accB[id] = input_b(id[0]);
+          accC[id] = input_c;
+        });
+  });
+
+  const auto s = measure(queue, [&](sycl::handler& cgh) {
+    sycl::accessor accA(a, cgh, sycl::write_only);
+    sycl::accessor accB(b, cgh, sycl::read_only);
+    sycl::accessor accC(c, cgh, sycl::read_only);
+    cgh.parallel_for<accessor_multi_ptr_kernel>(shape, [=](sycl::id<1> id) {
+      auto aPtr = accA.get_multi_ptr<sycl::access::decorated::yes>();
+      auto bPtr = accB.get_multi_ptr<sycl::access::decorated::yes>();
+      auto cPtr = accC.get_multi_ptr<sycl::access::decorated::yes>();
+      aPtr[id[0]] = bPtr[id[0]] + scalar * cPtr[id[0]];
+    });
+  });
+
+  sycl::host_accessor result(a, sycl::read_only);
+  INFO(name << ": the result is wrong");
+  CHECK(result[0] == expected(0));
+  CHECK(result[element_count - 1] == expected(element_count - 1));
+  return s;
+}
+
+template <int Dims>
+void measure_accessors(sycl::queue& queue,
+                       const bandwidth_reporter& reporter) {
+  const auto run = [&](auto variantTag) {
+    constexpr auto variant = decltype(variantTag)::value;
+    const std::string name = "accessor " + std::to_string(Dims) + "D, " +
+                             to_string(variant);
+    reporter.report(name, measure_accessor<Dims, variant>(queue, name));
+  };
+  run(std::integral_constant<accessor_variant,
+                             accessor_variant::whole_buffer>{});
+  run(std::integral_constant<accessor_variant, accessor_variant::ranged>{});
+  run(std::integral_constant<accessor_variant,
+                             accessor_variant::ranged_with_offset>{});
+}
+
+TEST_CASE("kernel memory access bandwidth", "[bench_kernel_access]") {
+  auto queue = util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations used as the "
+         "raw pointer baseline");
+  }
+
+  usm_arrays arrays(queue);
+  const bandwidth_reporter reporter(measure_raw_pointers(queue, arrays));
+
+  reporter.report("USM address_space_cast multi_ptr",
+                  measure_usm_multi_ptr(queue, arrays));
+  reporter.report("local_accessor", measure_local_accessor(queue, arrays));
+
+  measure_accessors<1>(queue, reporter);
+  measure_accessors<2>(queue, reporter);
+  measure_accessors<3>(queue, reporter);
+
+  const std::string multiPtrName = "accessor 1D, get_multi_ptr";
+  reporter.report(multiPtrName,
+                  measure_accessor_multi_ptr(queue, multiPtrName));
+}
+
+}  // namespace bench_kernel_access
@@ -0,0 +1,275 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the latency of obtaining kernel bundles and of
+//  their transitions between the bundle states
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench_kernel_bundle {
+using namespace sycl_cts;
+using namespace sycl_cts::benchmark;
+
+template <size_t Index>
+class pool_kernel;
+
+inline int expected(size_t index) { return static_cast<int>(index) * 3 + 1; }
+
+/**
+ * @brief Set of Count kernels starting at Offset in the kernel pool
+ *
+ * The sets of a benchmark do not share kernels, so a bundle never contains
+ * the kernels obtained by the previous measurements. Whether the kernels of
+ * the translation unit are compiled together is up to the implementation.
+ */
+template <size_t Offset, size_t Count>
+struct kernel_set {
+  static constexpr size_t size = Count;
+  static constexpr size_t end = Offset + Count;
+
+  static std::vector<sycl::kernel_id> get_ids() {
+    return get_ids(std::make_index_sequence<Count>{});
+  }
+
+  /**
+   * @brief Runs all the kernels of the set from the bundle and checks that
+   *        each one wrote its value
+   */
+  static void run(sycl::queue& queue,
+                  const sycl::kernel_bundle<sycl::bundle_state::executable>&
+                      bundle,
+                  const std::string& name) {
+    std::vector<int> results(end, 0);
+    {
+      sycl::buffer<int, 1> buffer(results.data(), sycl::range<1>(end));
+      run(queue, bundle, buffer, std::make_index_sequence<Count>{});
+    }
+    INFO(name << ": kernels of the bundle produced wrong results");
+    for (size_t i = Offset; i < end; ++i) {
+      CHECK(results[i] == expected(i));
+    }
+  }
+
+ private:
+  template <size_t... I>
+  static std::vector<sycl::kernel_id> get_ids(std::index_sequence<I...>) {
+    return {sycl::get_kernel_id<pool_kernel<Offset + I>>()...};
+  }
+
+  template <size_t... I>
+  static void run(
+      sycl::queue& queue,
+      const sycl::kernel_bundle<sycl::bundle_state::executable>& bundle,
+      sycl::buffer<int, 1>& buffer, std::index_sequence<I...>) {
+    (queue.submit([&](sycl::handler& cgh) {
+      cgh.use_kernel_bundle(bundle);
+      sycl::accessor acc(buffer, cgh, sycl::write_only);
+      cgh.single_task<pool_kernel<Offset + I>>(
+          [=] { acc[Offset + I] = expected(Offset + I); });
+    }),
+     ...);
+    queue.wait_and_throw();
+  }
+};
+
+using set_of_1 = kernel_set<0, 1>;
+using set_of_10 = kernel_set<set_of_1::end, 10>;
+using set_of_100 = kernel_set<set_of_10::end, 100>;
+
+template <typename SetT>
+std::string row_name() {
+  return std::to_string(SetT::size) +
+         (SetT::size == 1 ? " kernel" : " kernels");
+}
+
+template <typename FunctionT>
+void for_all_sets(FunctionT&& f) {
+  f(set_of_1{});
+  f(set_of_10{});
+  f(set_of_100{});
+}
+
+constexpr double ms = 1e3;
+
+/**
+ * @brief Measures the first and the repeated calls of a bundle transition,
+ *        returns the first and the median of the repeated ones in ms
+ */
+template <typename TransitionT>
+std::vector<double> measure_transition(const TransitionT& transition) {
+  const auto first = time_call(transition);
+  const auto repeated =
+      collect([&] { return time_call(transition); }).percentile(0.5);
+  return {first.count() * ms, repeated * ms};
+}
+
+/**
+ * @brief Measures get_kernel_bundle for the first time, repeated in the same
+ *        context and repeated in a fresh context, returns the first and the
+ *        medians of the repeated ones in ms
+ *
+ * The repeated calls in the same context may be served by the in-memory
+ * cache of the runtime. A fresh context has none, so the calls in a fresh
+ * context only get faster than the first one due to a persistent cache.
+ */
+template <sycl::bundle_state State>
+std::vector<double> measure_get(const sycl::queue& queue,
+                                const std::vector<sycl::kernel_id>& ids) {
+  const auto context = queue.get_context();
+  const auto device = queue.get_device();
+  const auto get = [&](const sycl::context& ctx) {
+    return sycl::get_kernel_bundle<State>(ctx, {device}, ids);
+  };
+
+  const auto first = time_call([&] { get(context); });
+  const auto sameContext =
+      collect([&] { return time_call([&] { get(context); }); });
+  const auto freshContext = collect([&] {
+    const sycl::context fresh(device);
+    return time_call([&] { get(fresh); });
+  });
+  return {first.count() * ms, sameContext.percentile(0.5) * ms,
+          freshContext.percentile(0.5) * ms};
+}
+
+/**
+ * @brief Reports how much faster the repeated get_kernel_bundle calls are
+ *        than the first one, values as returned by measure_get
+ */
+void report_cache_speedup(const std::string& name,
+                          const std::vector<double>& get) {
+  const auto speedup = [&](double repeated) {
+    return repeated > 0 ? get[0] / repeated : 0.0;
+  };
+  report_measurement(name + ", in-memory cache speedup", speedup(get[1]),
+                     "x");
+  report_measurement(name + ", fresh context speedup", speedup(get[2]), "x");
+}
+
+const std::vector<std::string> get_columns{
+    "get first", "get same context", "get fresh context"};
+
+/**
+ * @brief Checks whether all the kernels of the benchmark are available in the
+ *        given state, e.g. an ahead-of-time compiled program may provide no
+ *        input bundles
+ */
+template <sycl::bundle_state State>
+bool has_all_kernels(const sycl::queue& queue) {
+  bool result = true;
+  for_all_sets([&](auto set) {
+    result = result && sycl::has_kernel_bundle<State>(
+                           queue.get_context(), {queue.get_device()},
+                           decltype(set)::get_ids());
+  });
+  return result;
+}
+
+TEST_CASE("input bundle latency", "[bench_kernel_bundle]") {
+  auto queue = util::get_cts_object::queue();
+  if (!has_all_kernels<sycl::bundle_state::input>(queue)) {
+    SKIP("Kernels are not available in the input state");
+  }
+  table results("input bundle", get_columns, "ms");
+
+  for_all_sets([&](auto set) {
+    using set_t = decltype(set);
+    const auto get =
+        measure_get<sycl::bundle_state::input>(queue, set_t::get_ids());
+    results.add_row(row_name<set_t>(), get);
+  });
+  results.print();
+}
+
+TEST_CASE("object bundle latency", "[bench_kernel_bundle]") {
+  auto queue = util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::online_compiler)) {
+    SKIP("Device does not support online compiling of device code");
+  }
+  if (!has_all_kernels<sycl::bundle_state::input>(queue)) {
+    SKIP("Kernels are not available in the input state");
+  }
+  std::vector<std::string> columns = get_columns;
+  columns.insert(columns.end(), {"compile first", "compile"});
+  table results("object bundle", columns, "ms");
+
+  for_all_sets([&](auto set) {
+    using set_t = decltype(set);
+    const auto ids = set_t::get_ids();
+    auto row = measure_get<sycl::bundle_state::object>(queue, ids);
+
+    const auto input = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+        queue.get_context(), {queue.get_device()}, ids);
+    const auto compile = measure_transition([&] { sycl::compile(input); });
+    row.insert(row.end(), compile.begin(), compile.end());
+    results.add_row(row_name<set_t>(), row);
+  });
+  results.print();
+}
+
+TEST_CASE("executable bundle latency", "[bench_kernel_bundle]") {
+  auto queue = util::get_cts_object::queue();
+  const auto& device = queue.get_device();
+  const bool canTransition = device.has(sycl::aspect::online_compiler) &&
+                             device.has(sycl::aspect::online_linker) &&
+                             has_all_kernels<sycl::bundle_state::input>(queue);
+  if (!canTransition) {
+    WARN("Device does not support online compiling or linking of device "
+         "code, only get_kernel_bundle is measured");
+  }
+  std::vector<std::string> columns = get_columns;
+  columns.insert(columns.end(), {"link first", "link", "build first", "build"});
+  table results("executable bundle", columns, "ms");
+
+  for_all_sets([&](auto set) {
+    using set_t = decltype(set);
+    const auto ids = set_t::get_ids();
+    const auto name = "executable bundle, " + row_name<set_t>();
+    // Measured first to observe the cold get_kernel_bundle of the set
+    const auto get = measure_get<sycl::bundle_state::executable>(queue, ids);
+    set_t::run(queue,
+               sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+                   queue.get_context(), {device}, ids),
+               name + ", get_kernel_bundle");
+
+    auto row = get;
+    if (canTransition) {
+      const auto input = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+          queue.get_context(), {device}, ids);
+      const auto object = sycl::compile(input);
+      const auto link = measure_transition([&] { sycl::link(object); });
+      const auto build = measure_transition([&] { sycl::build(input); });
+      row.insert(row.end(), link.begin(), link.end());
+      row.insert(row.end(), build.begin(), build.end());
+      set_t::run(queue, sycl::link(object), name + ", link");
+      set_t::run(queue, sycl::build(input), name + ", build");
+    }
+    results.add_row(row_name<set_t>(), row);
+    report_cache_speedup(name, get);
+  });
+  results.print();
+}
+
+}  // namespace bench_kernel_bundle
@@ -0,0 +1,182 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the overhead of the runtime per command
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/invoke.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace bench_runtime_overhead {
+using namespace sycl_cts;
+using namespace sycl_cts::benchmark;
+
+// Number of commands submitted by a single sample of the throughput
+constexpr size_t submission_batch = 1000;
+
+// Number of elements written by the kernels accessing memory
+constexpr size_t element_count = 1024;
+constexpr size_t work_group_size = 16;
+
+class empty_kernel;
+class buffer_kernel;
+class usm_kernel;
+
+sycl::event submit_empty_kernel(sycl::queue& queue) {
+  return queue.submit(
+      [](sycl::handler& cgh) { cgh.single_task<empty_kernel>([] {}); });
+}
+
+/**
+ * @brief Submits a kernel incrementing each element through the pointer or
+ *        accessor, with the same nd_range as the group tests
+ */
+template <typename kernelT, typename dataT>
+sycl::event submit_increment_kernel(sycl::queue& queue, dataT data) {
+  return queue.submit([&](sycl::handler& cgh) {
+    auto target = data(cgh);
+    invoke_nd_item<1, kernelT>{}(
+        cgh, sycl::range<1>(element_count), sycl::range<1>(work_group_size),
+        [=](sycl::nd_item<1>, size_t index) { target[index] += 1; });
+  });
+}
+
+void report_submission_throughput(const std::string& name,
+                                  sycl::queue& queue) {
+  report_throughput(name, collect([&] {
+                      const auto time = time_call([&] {
+                        for (size_t i = 0; i < submission_batch; ++i) {
+                          submit_empty_kernel(queue);
+                        }
+                      });
+                      queue.wait_and_throw();
+                      return time;
+                    }),
+                    submission_batch, "submissions/s");
+}
+
+TEST_CASE("empty kernel latency", "[bench_runtime_overhead]") {
+  auto queue = util::get_cts_object::queue();
+
+  SECTION("submit") {
+    report_latency("submit", collect([&] {
+                     sycl::event event;
+                     const auto time =
+                         time_call([&] { event = submit_empty_kernel(queue); });
+                     event.wait();
+                     return time;
+                   }));
+  }
+  SECTION("wait") {
+    report_latency("wait", collect([&] {
+                     auto event = submit_empty_kernel(queue);
+                     return time_call([&] { event.wait(); });
+                   }));
+  }
+  SECTION("submit and wait") {
+    report_latency("submit and wait", collect([&] {
+                     return time_call(
+                         [&] { submit_empty_kernel(queue).wait(); });
+                   }));
+  }
+}
+
+TEST_CASE("empty kernel submission throughput", "[bench_runtime_overhead]") {
+  auto queue = util::get_cts_object::queue();
+
+  SECTION("out-of-order queue") {
+    report_submission_throughput("out-of-order queue submission", queue);
+  }
+  SECTION("in-order queue") {
+    sycl::queue inOrderQueue(queue.get_context(), queue.get_device(),
+                             cts_async_handler{},
+                             {sycl::property::queue::in_order()});
+    report_submission_throughput("in-order queue submission", inOrderQueue);
+  }
+}
+
+TEST_CASE("buffer accessor and USM kernel latency",
+          "[bench_runtime_overhead]") {
+  auto queue = util::get_cts_object::queue();
+  std::vector<int> result(element_count, 0);
+
+  SECTION("buffer accessor") {
+    {
+      sycl::buffer<int, 1> buffer(result.data(), sycl::range<1>(element_count));
+      const auto accessor = [&](sycl::handler& cgh) {
+        return sycl::accessor(buffer, cgh, sycl::read_write);
+      };
+      report_latency("buffer accessor", collect([&] {
+                       return time_call([&] {
+                         submit_increment_kernel<buffer_kernel>(queue,
+                                                                accessor)
+                             .wait();
+                       });
+                     }));
+    }
+  }
+  SECTION("USM device pointer") {
+    if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+      SKIP("Device does not support USM device allocations");
+    }
+    int* ptr = sycl::malloc_device<int>(element_count, queue);
+    queue.memset(ptr, 0, element_count * sizeof(int)).wait();
+    const auto pointer = [ptr](sycl::handler&) { return ptr; };
+    report_latency("USM device pointer", collect([&] {
+                     return time_call([&] {
+                       submit_increment_kernel<usm_kernel>(queue, pointer)
+                           .wait();
+                     });
+                   }));
+    queue.memcpy(result.data(), ptr, element_count * sizeof(int)).wait();
+    sycl::free(ptr, queue);
+  }
+
+  // Every call of the kernel increments all elements once
+  const bool consistent =
+      std::all_of(result.begin(), result.end(),
+                  [&](int value) { return value == result.front(); });
+  CHECK(consistent);
+  CHECK(result.front() > 0);
+}
+
+TEST_CASE("host_task round trip", "[bench_runtime_overhead]") {
+  auto queue = util::get_cts_object::queue();
+  std::atomic<size_t> calls{0};
+  size_t submitted = 0;
+
+  report_latency("host_task round trip", collect([&] {
+                   ++submitted;
+                   return time_call([&] {
+                     queue
+                         .submit([&](sycl::handler& cgh) {
+                           cgh.host_task([&] { ++calls; });
+                         })
+                         .wait();
+                   });
+                 }));
+  CHECK(calls == submitted);
+}
+
+}  // namespace bench_runtime_overhead
@@ -0,0 +1,233 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the cost of re-specializing a kernel for many
+//  distinct sets of specialization constant values
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench_spec_constants {
+using namespace sycl_cts;
+using namespace sycl_cts::benchmark;
+
+// Number of distinct sets of specialization constant values cycled through
+constexpr int value_set_count = 256;
+
+// Number of elements written by a single run of the kernel
+constexpr size_t element_count = 64;
+
+constexpr sycl::specialization_id<int> scale(1);
+constexpr sycl::specialization_id<int> offset(0);
+
+/**
+ * @brief Values of the specialization constants, distinct for every index
+ */
+struct value_set {
+  int scale;
+  int offset;
+
+  explicit value_set(int index) : scale(index + 2), offset(3 * index + 1) {}
+
+  int expected(size_t element) const {
+    return static_cast<int>(element) * scale + offset;
+  }
+};
+
+/**
+ * @brief Checks that the kernel produced the results of the value set
+ */
+void check_results(sycl::buffer<int, 1>& buffer, const value_set& values,
+                   const std::string& name) {
+  sycl::host_accessor results(buffer, sycl::read_only);
+  bool correct = true;
+  for (size_t i = 0; i < element_count; ++i) {
+    correct = correct && results[i] == values.expected(i);
+  }
+  INFO(name << ": wrong results for scale " << values.scale << " and offset "
+            << values.offset);
+  CHECK(correct);
+}
+
+/**
+ * @brief Reports the latency of the first and the repeated uses of the value
+ *        sets, and the growth of the resident memory over the first uses
+ */
+void report(const std::string& name, const samples& firstUse,
+            const samples& repeatedUse, std::size_t memoryBefore,
+            std::size_t memoryAfter) {
+  report_latency(name + ", first use", firstUse);
+  report_latency(name + ", repeated use", repeatedUse);
+  if (memoryBefore == 0 || memoryAfter == 0) return;
+  // The memory may also shrink, e.g. when the runtime evicts its caches
+  const double growth = static_cast<double>(memoryAfter) -
+                        static_cast<double>(memoryBefore);
+  report_measurement(name + ", memory growth", growth / (1024 * 1024), "MiB");
+  report_measurement(name + ", memory growth per value set",
+                     growth / 1024 / value_set_count, "KiB");
+}
+
+class handler_kernel;
+
+/**
+ * @brief Runs the kernel specialized through the handler and waits for it
+ */
+void run_with_handler(sycl::queue& queue, sycl::buffer<int, 1>& buffer,
+                      const value_set& values) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor acc(buffer, cgh, sycl::write_only, sycl::no_init);
+        cgh.set_specialization_constant<scale>(values.scale);
+        cgh.set_specialization_constant<offset>(values.offset);
+        cgh.parallel_for<handler_kernel>(
+            sycl::range<1>(element_count),
+            [=](sycl::id<1> id, sycl::kernel_handler h) {
+              acc[id] = static_cast<int>(id[0]) *
+                            h.get_specialization_constant<scale>() +
+                        h.get_specialization_constant<offset>();
+            });
+      })
+      .wait_and_throw();
+}
+
+TEST_CASE("re-specialization through the handler", "[bench_spec_constants]") {
+  auto queue = util::get_cts_object::queue();
+  sycl::buffer<int, 1> buffer{sycl::range<1>(element_count)};
+  const std::string name = "handler::set_specialization_constant";
+
+  // Compiles the kernel, so the first uses only measure the specialization
+  run_with_handler(queue, buffer, value_set(value_set_count));
+
+  samples firstUse;
+  const auto memoryBefore = get_resident_memory();
+  for (int i = 0; i < value_set_count; ++i) {
+    const value_set values(i);
+    firstUse.add(time_call([&] { run_with_handler(queue, buffer, values); }));
+    check_results(buffer, values, name + ", first use");
+  }
+  const auto memoryAfter = get_resident_memory();
+
+  samples repeatedUse;
+  for (int i = 0; i < value_set_count; ++i) {
+    const value_set values(i);
+    repeatedUse.add(
+        time_call([&] { run_with_handler(queue, buffer, values); }));
+    check_results(buffer, values, name + ", repeated use");
+  }
+
+  report(name, firstUse, repeatedUse, memoryBefore, memoryAfter);
+}
+
+class bundle_kernel;
+
+/**
+ * @brief Runs the kernel from the executable bundle and waits for it
+ */
+void run_with_bundle(
+    sycl::queue& queue, sycl::buffer<int, 1>& buffer,
+    const sycl::kernel_bundle<sycl::bundle_state::executable>& bundle) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        cgh.use_kernel_bundle(bundle);
+        sycl::accessor acc(buffer, cgh, sycl::write_only, sycl::no_init);
+        cgh.parallel_for<bundle_kernel>(
+            sycl::range<1>(element_count),
+            [=](sycl::id<1> id, sycl::kernel_handler h) {
+              acc[id] = static_cast<int>(id[0]) *
+                            h.get_specialization_constant<scale>() +
+                        h.get_specialization_constant<offset>();
+            });
+      })
+      .wait_and_throw();
+}
+
+TEST_CASE("re-specialization through the kernel bundle",
+          "[bench_spec_constants]") {
+  auto queue = util::get_cts_object::queue();
+  const auto& device = queue.get_device();
+  if (!device.has(sycl::aspect::online_compiler) ||
+      !device.has(sycl::aspect::online_linker)) {
+    SKIP("Device does not support online compiling or linking of device "
+         "code");
+  }
+  const auto kernelId = sycl::get_kernel_id<bundle_kernel>();
+  if (!sycl::has_kernel_bundle<sycl::bundle_state::input>(
+          queue.get_context(), {device}, {kernelId})) {
+    SKIP("Kernel is not available in the input state");
+  }
+  sycl::buffer<int, 1> buffer{sycl::range<1>(element_count)};
+
+  // Copies of a kernel_bundle share its state, so every value set starts
+  // from an input bundle of its own to leave the others unchanged
+  const auto get_input = [&] {
+    return sycl::get_kernel_bundle<sycl::bundle_state::input>(
+        queue.get_context(), {device}, {kernelId});
+  };
+  const auto specialize_and_build =
+      [&](sycl::kernel_bundle<sycl::bundle_state::input> bundle,
+          const value_set& values) {
+        bundle.set_specialization_constant<scale>(values.scale);
+        bundle.set_specialization_constant<offset>(values.offset);
+        return sycl::build(bundle);
+      };
+
+  // The build of every value set is measured separately from the first run
+  // of the resulting bundle
+  const auto measure = [&](samples& build, samples& run,
+                           const value_set& values, const std::string& name) {
+    auto input = get_input();
+    const auto start = clock_type::now();
+    const auto bundle = specialize_and_build(std::move(input), values);
+    build.add(clock_type::now() - start);
+    run.add(time_call([&] { run_with_bundle(queue, buffer, bundle); }));
+    check_results(buffer, values, name);
+  };
+
+  // Warms up the runtime with a value set that is not measured
+  run_with_bundle(queue, buffer,
+                  specialize_and_build(get_input(), value_set(-1)));
+
+  samples firstBuild;
+  samples firstRun;
+  const auto memoryBefore = get_resident_memory();
+  for (int i = 0; i < value_set_count; ++i) {
+    measure(firstBuild, firstRun, value_set(i),
+            "kernel_bundle::set_specialization_constant, first use");
+  }
+  const auto memoryAfter = get_resident_memory();
+
+  samples repeatedBuild;
+  samples repeatedRun;
+  for (int i = 0; i < value_set_count; ++i) {
+    measure(repeatedBuild, repeatedRun, value_set(i),
+            "kernel_bundle::set_specialization_constant, repeated use");
+  }
+
+  report("kernel_bundle::set_specialization_constant and build", firstBuild,
+         repeatedBuild, memoryBefore, memoryAfter);
+  report_latency("built bundle, first use, first run", firstRun);
+  report_latency("built bundle, repeated use, first run", repeatedRun);
+}
+
+}  // namespace bench_spec_constants
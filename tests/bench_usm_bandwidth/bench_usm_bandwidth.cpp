@@ -0,0 +1,398 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the bandwidth and the latency of the USM memory
+//  operations over the transfer size
+//
+*******************************************************************************/
+
+#include "../../util/test_options.h"
+#include "../../util/usm_helper.h"
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace bench_usm_bandwidth {
+using namespace sycl_cts;
+using namespace sycl_cts::benchmark;
+
+// Copies and fills work on elements of this type, all the transfer sizes are
+// multiples of its size
+using element_t = std::uint32_t;
+
+constexpr element_t pattern = 0xA5C3E1F7;
+
+// Transfer sizes grow by this factor from the size of element_t
+constexpr size_t size_factor = 4;
+
+// Samples of the large transfers are limited to transfer about this number of
+// bytes per measurement, but there are at least min_sample_count of them
+constexpr size_t bytes_per_measurement = size_t{4} << 30;
+constexpr size_t min_sample_count = 3;
+
+// Number of events the operation depends on in the "many" case
+constexpr size_t many_dependencies = 16;
+
+// Transfer size of the dependency overhead measurement
+constexpr size_t dependency_transfer_bytes = size_t{1} << 20;
+
+constexpr sycl::usm::alloc all_allocs[] = {
+    sycl::usm::alloc::host, sycl::usm::alloc::shared, sycl::usm::alloc::device};
+
+/**
+ * @brief Returns the transfer sizes from the size of element_t up to the
+ *        `--usm-max-bytes` CLI parameter, bounded by the device limit
+ */
+std::vector<size_t> get_sizes(const sycl::queue& queue) {
+  const size_t maxBytes = std::min<size_t>(
+      util::get<util::test_options>().get_usm_benchmark_max_bytes(),
+      queue.get_device().get_info<sycl::info::device::max_mem_alloc_size>());
+  std::vector<size_t> sizes;
+  for (size_t bytes = sizeof(element_t); bytes <= maxBytes;
+       bytes *= size_factor) {
+    sizes.push_back(bytes);
+  }
+  return sizes;
+}
+
+size_t get_sample_count(size_t bytes) {
+  return std::clamp(bytes_per_measurement / bytes, min_sample_count,
+                    std::max(min_sample_count, benchmark::get_sample_count()));
+}
+
+std::string size_name(size_t bytes) {
+  const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  size_t unit = 0;
+  while (bytes >= 1024 && bytes % 1024 == 0 && unit + 1 < std::size(units)) {
+    bytes /= 1024;
+    ++unit;
+  }
+  return std::to_string(bytes) + " " + units[unit];
+}
+
+std::string alloc_name(sycl::usm::alloc kind) {
+  switch (kind) {
+    case sycl::usm::alloc::host:
+      return "host";
+    case sycl::usm::alloc::shared:
+      return "shared";
+    case sycl::usm::alloc::device:
+      return "device";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief Allocation of the given kind with the size of the largest transfer,
+ *        empty if the device does not support the kind
+ */
+class allocation {
+ public:
+  allocation(sycl::queue& queue, sycl::usm::alloc kind, size_t bytes)
+      : queue(queue), count(bytes / sizeof(element_t)) {
+    switch (kind) {
+      case sycl::usm::alloc::host:
+        allocate<sycl::usm::alloc::host>();
+        break;
+      case sycl::usm::alloc::shared:
+        allocate<sycl::usm::alloc::shared>();
+        break;
+      case sycl::usm::alloc::device:
+        allocate<sycl::usm::alloc::device>();
+        break;
+      default:
+        break;
+    }
+  }
+
+  allocation(const allocation&) = delete;
+  allocation& operator=(const allocation&) = delete;
+
+  ~allocation() {
+    if (ptr != nullptr) sycl::free(ptr, queue.get_context());
+  }
+
+  element_t* get() const { return ptr; }
+
+ private:
+  template <sycl::usm::alloc Kind>
+  void allocate() {
+    if (!queue.get_device().has(usm_helper::get_aspect<Kind>())) return;
+    // The deleter of the helper is not stored, the memory is freed with the
+    // same context by the destructor
+    ptr = usm_helper::allocate_usm_memory<Kind, element_t>(queue, count)
+              .release();
+  }
+
+  sycl::queue& queue;
+  size_t count;
+  element_t* ptr = nullptr;
+};
+
+/**
+ * @brief Checks that the first and the last elements of the transfer hold
+ *        the expected value
+ */
+void check_transfer(sycl::queue& queue, const element_t* dst, size_t bytes,
+                    element_t expected, const std::string& name) {
+  const size_t count = bytes / sizeof(element_t);
+  element_t ends[2]{};
+  queue.memcpy(&ends[0], dst, sizeof(element_t));
+  queue.memcpy(&ends[1], dst + count - 1, sizeof(element_t));
+  queue.wait_and_throw();
+  INFO(name << ": the transferred values are wrong");
+  CHECK(ends[0] == expected);
+  CHECK(ends[1] == expected);
+}
+
+enum class copy_api { queue_memcpy, handler_memcpy, queue_copy, handler_copy };
+
+constexpr copy_api all_copy_apis[] = {
+    copy_api::queue_memcpy, copy_api::handler_memcpy, copy_api::queue_copy,
+    copy_api::handler_copy};
+
+std::string to_string(copy_api api) {
+  switch (api) {
+    case copy_api::queue_memcpy:
+      return "queue::memcpy";
+    case copy_api::handler_memcpy:
+      return "handler::memcpy";
+    case copy_api::queue_copy:
+      return "queue::copy";
+    case copy_api::handler_copy:
+      return "handler::copy";
+  }
+  return "unknown";
+}
+
+sycl::event submit_copy(sycl::queue& queue, copy_api api, element_t* dst,
+                        const element_t* src, size_t bytes,
+                        const std::vector<sycl::event>& dependencies = {}) {
+  const size_t count = bytes / sizeof(element_t);
+  switch (api) {
+    case copy_api::queue_memcpy:
+      return queue.memcpy(dst, src, bytes, dependencies);
+    case copy_api::handler_memcpy:
+      return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.memcpy(dst, src, bytes);
+      });
+    case copy_api::queue_copy:
+      return queue.copy(src, dst, count, dependencies);
+    case copy_api::handler_copy:
+      return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.copy(src, dst, count);
+      });
+  }
+  return {};
+}
+
+enum class fill_api { queue_memset, handler_memset, queue_fill, handler_fill };
+
+constexpr fill_api all_fill_apis[] = {fill_api::queue_memset,
+                                      fill_api::handler_memset,
+                                      fill_api::queue_fill,
+                                      fill_api::handler_fill};
+
+std::string to_string(fill_api api) {
+  switch (api) {
+    case fill_api::queue_memset:
+      return "queue::memset";
+    case fill_api::handler_memset:
+      return "handler::memset";
+    case fill_api::queue_fill:
+      return "queue::fill";
+    case fill_api::handler_fill:
+      return "handler::fill";
+  }
+  return "unknown";
+}
+
+// Byte written by the memset variants
+constexpr int memset_value = 0x5A;
+
+sycl::event submit_fill(sycl::queue& queue, fill_api api, element_t* dst,
+                        size_t bytes) {
+  const size_t count = bytes / sizeof(element_t);
+  switch (api) {
+    case fill_api::queue_memset:
+      return queue.memset(dst, memset_value, bytes);
+    case fill_api::handler_memset:
+      return queue.submit(
+          [&](sycl::handler& cgh) { cgh.memset(dst, memset_value, bytes); });
+    case fill_api::queue_fill:
+      return queue.fill(dst, pattern, count);
+    case fill_api::handler_fill:
+      return queue.submit(
+          [&](sycl::handler& cgh) { cgh.fill(dst, pattern, count); });
+  }
+  return {};
+}
+
+TEST_CASE("USM copy bandwidth", "[bench_usm_bandwidth]") {
+  auto queue = util::get_cts_object::queue();
+  const auto sizes = get_sizes(queue);
+
+  for (auto srcKind : all_allocs) {
+    for (auto dstKind : all_allocs) {
+      const std::string pair =
+          alloc_name(srcKind) + " -> " + alloc_name(dstKind);
+      allocation src(queue, srcKind, sizes.back());
+      allocation dst(queue, dstKind, sizes.back());
+      if (src.get() == nullptr || dst.get() == nullptr) {
+        WARN(pair << " copies are skipped, allocation is not supported");
+        continue;
+      }
+      queue.fill(src.get(), pattern, sizes.back() / sizeof(element_t)).wait();
+
+      for (auto api : all_copy_apis) {
+        for (size_t bytes : sizes) {
+          const std::string name =
+              to_string(api) + ", " + pair + ", " + size_name(bytes);
+          queue.memset(dst.get(), 0, bytes).wait();
+          const auto s = collect(
+              [&] {
+                return time_call([&] {
+                  submit_copy(queue, api, dst.get(), src.get(), bytes).wait();
+                });
+              },
+              get_sample_count(bytes));
+          report_bandwidth(name, s, bytes);
+          check_transfer(queue, dst.get(), bytes, pattern, name);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("USM fill bandwidth", "[bench_usm_bandwidth]") {
+  auto queue = util::get_cts_object::queue();
+  const auto sizes = get_sizes(queue);
+  element_t memsetPattern;
+  std::fill_n(reinterpret_cast<unsigned char*>(&memsetPattern),
+              sizeof(element_t), static_cast<unsigned char>(memset_value));
+
+  for (auto kind : all_allocs) {
+    allocation dst(queue, kind, sizes.back());
+    if (dst.get() == nullptr) {
+      WARN(alloc_name(kind) << " fills are skipped, allocation is not "
+                               "supported");
+      continue;
+    }
+    for (auto api : all_fill_apis) {
+      const bool isMemset =
+          api == fill_api::queue_memset || api == fill_api::handler_memset;
+      for (size_t bytes : sizes) {
+        const std::string name =
+            to_string(api) + ", " + alloc_name(kind) + ", " + size_name(bytes);
+        queue.memset(dst.get(), 0, bytes).wait();
+        const auto s = collect(
+            [&] {
+              return time_call(
+                  [&] { submit_fill(queue, api, dst.get(), bytes).wait(); });
+            },
+            get_sample_count(bytes));
+        report_bandwidth(name, s, bytes);
+        check_transfer(queue, dst.get(), bytes,
+                       isMemset ? memsetPattern : pattern, name);
+      }
+    }
+  }
+}
+
+class dependency_kernel;
+
+TEST_CASE("USM copy latency with dependencies", "[bench_usm_bandwidth]") {
+  auto queue = util::get_cts_object::queue();
+  const size_t maxBytes = get_sizes(queue).back();
+
+  for (auto kind : all_allocs) {
+    allocation src(queue, kind, maxBytes);
+    allocation dst(queue, kind, maxBytes);
+    if (src.get() == nullptr || dst.get() == nullptr) continue;
+    queue.fill(src.get(), pattern, maxBytes / sizeof(element_t)).wait();
+
+    for (size_t bytes : {sizeof(element_t),
+                         std::min(dependency_transfer_bytes, maxBytes)}) {
+      for (size_t dependencyCount : {size_t{0}, size_t{1}, many_dependencies}) {
+        const std::string name =
+            "queue::memcpy, " + alloc_name(kind) + " -> " + alloc_name(kind) +
+            ", " + size_name(bytes) + ", " + std::to_string(dependencyCount) +
+            " dependencies";
+        const auto s = collect([&] {
+          // The dependencies are complete, so only their tracking is measured
+          std::vector<sycl::event> dependencies;
+          for (size_t i = 0; i < dependencyCount; ++i) {
+            dependencies.push_back(queue.single_task<dependency_kernel>([] {}));
+          }
+          sycl::event::wait(dependencies);
+          return time_call([&] {
+            submit_copy(queue, copy_api::queue_memcpy, dst.get(), src.get(),
+                        bytes, dependencies)
+                .wait();
+          });
+        });
+        report_latency(name, s);
+        check_transfer(queue, dst.get(), bytes, pattern, name);
+      }
+    }
+  }
+}
+
+TEST_CASE("USM prefetch and mem_advise latency", "[bench_usm_bandwidth]") {
+  auto queue = util::get_cts_object::queue();
+  const auto sizes = get_sizes(queue);
+  allocation shared(queue, sycl::usm::alloc::shared, sizes.back());
+  if (shared.get() == nullptr) {
+    SKIP("Device does not support USM shared allocations");
+  }
+
+  for (size_t bytes : sizes) {
+    const auto measure = [&](const std::string& operation,
+                             const auto& submit) {
+      const auto s = collect(
+          [&] { return time_call([&] { submit().wait(); }); },
+          get_sample_count(bytes));
+      report_measurement(operation + ", " + size_name(bytes),
+                         s.percentile(0.5) * 1e6, "us");
+    };
+    measure("queue::prefetch",
+            [&] { return queue.prefetch(shared.get(), bytes); });
+    measure("handler::prefetch", [&] {
+      return queue.submit(
+          [&](sycl::handler& cgh) { cgh.prefetch(shared.get(), bytes); });
+    });
+    // Advice 0 is the default behavior of the implementations
+    measure("queue::mem_advise",
+            [&] { return queue.mem_advise(shared.get(), bytes, 0); });
+    measure("handler::mem_advise", [&] {
+      return queue.submit([&](sycl::handler& cgh) {
+        cgh.mem_advise(shared.get(), bytes, 0);
+      });
+    });
+  }
+}
+
+}  // namespace bench_usm_bandwidth
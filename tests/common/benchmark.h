@@ -0,0 +1,262 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+//  Provide the sampling and statistics of the benchmarks
+
+#ifndef __SYCLCTS_TESTS_COMMON_BENCHMARK_H
+#define __SYCLCTS_TESTS_COMMON_BENCHMARK_H
+
+#include "measurements.h"
+
+#include <catch2/interfaces/catch_interfaces_config.hpp>
+#include <catch2/internal/catch_context.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sycl_cts {
+namespace benchmark {
+
+using clock_type = std::chrono::steady_clock;
+using duration = std::chrono::duration<double>;
+
+/**
+ * @brief Returns the wall time of the call of f
+ */
+template <typename FunctionT>
+duration time_call(FunctionT&& f) {
+  const auto start = clock_type::now();
+  f();
+  return clock_type::now() - start;
+}
+
+/**
+ * @brief Calls f once to exclude the one-time costs such as the kernel
+ *        compilation or the transfer of the input, then returns the wall time
+ *        of the second call
+ */
+template <typename FunctionT>
+duration time_warm_call(FunctionT&& f) {
+  f();
+  return time_call(f);
+}
+
+/**
+ * @brief Returns the resident memory of the process in bytes, or zero where it
+ *        cannot be queried
+ */
+inline std::size_t get_resident_memory() {
+  // Only Linux is supported for now
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmRSS:", 0) == 0) {
+      std::istringstream fields(line.substr(6));
+      std::size_t kib = 0;
+      fields >> kib;
+      return kib * 1024;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Wall times of the repetitions of a measured operation
+ */
+class samples {
+ public:
+  void add(duration sample) { seconds.push_back(sample.count()); }
+
+  std::size_t size() const { return seconds.size(); }
+
+  double mean() const {
+    return seconds.empty() ? 0.0
+                           : std::accumulate(seconds.begin(), seconds.end(),
+                                             0.0) /
+                                 seconds.size();
+  }
+
+  /**
+   * @brief Returns the sample below which the given fraction of the samples
+   *        falls, using the nearest-rank method
+   */
+  double percentile(double fraction) const {
+    if (seconds.empty()) return 0.0;
+    std::vector<double> sorted = seconds;
+    std::sort(sorted.begin(), sorted.end());
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+  }
+
+ private:
+  std::vector<double> seconds;
+};
+
+/**
+ * @brief Returns the number of samples set by the `--benchmark-samples` CLI
+ *        parameter of Catch2
+ */
+inline std::size_t get_sample_count() {
+  return Catch::getCurrentContext().getConfig()->benchmarkSamples();
+}
+
+/**
+ * @brief Collects the samples of the operation measured by body
+ *
+ * body is called repeatedly for the time set by the `--benchmark-warmup-time`
+ * CLI parameter of Catch2 first, so the results do not include the one-time
+ * costs such as the kernel compilation or the runtime initialization. Then
+ * body is called once per sample. body returns the duration of the measured
+ * part, which lets it exclude the set up and the clean up of each sample.
+ *
+ * @param count Number of samples, the `--benchmark-samples` CLI parameter by
+ *        default. Long operations may use fewer samples.
+ */
+template <typename BodyT>
+samples collect(const BodyT& body, std::size_t count = get_sample_count()) {
+  const auto warmupTime =
+      Catch::getCurrentContext().getConfig()->benchmarkWarmupTime();
+  const auto warmupEnd = clock_type::now() + warmupTime;
+  // At least one call, so the first sample is never a cold one
+  do {
+    body();
+  } while (clock_type::now() < warmupEnd);
+
+  samples result;
+  for (std::size_t i = 0; i < count; ++i) {
+    result.add(body());
+  }
+  return result;
+}
+
+/**
+ * @brief Reports the mean and the percentiles of the latency in microseconds
+ */
+inline void report_latency(const std::string& name, const samples& s) {
+  constexpr double us = 1e6;
+  report_measurement(name + ", mean", s.mean() * us, "us");
+  report_measurement(name + ", p50", s.percentile(0.5) * us, "us");
+  report_measurement(name + ", p90", s.percentile(0.9) * us, "us");
+  report_measurement(name + ", p99", s.percentile(0.99) * us, "us");
+}
+
+/**
+ * @brief Returns the median bandwidth in GB/s, each sample transferring the
+ *        given number of bytes
+ */
+inline double get_bandwidth(const samples& s, std::size_t bytes) {
+  const double seconds = s.percentile(0.5);
+  return seconds > 0 ? bytes / seconds / 1e9 : 0.0;
+}
+
+/**
+ * @brief Reports the median bandwidth in GB/s, each sample transferring the
+ *        given number of bytes
+ */
+inline void report_bandwidth(const std::string& name, const samples& s,
+                             std::size_t bytes) {
+  report_measurement(name, get_bandwidth(s, bytes), "GB/s");
+}
+
+/**
+ * @brief Reports the median throughput and its 10th and 90th percentiles,
+ *        each sample measuring the given number of operations
+ */
+inline void report_throughput(const std::string& name, const samples& s,
+                              std::size_t operations, const std::string& unit) {
+  const auto rate = [&](double seconds) {
+    return seconds > 0 ? static_cast<double>(operations) / seconds : 0.0;
+  };
+  // Longer samples give lower throughput
+  report_measurement(name + ", p50", rate(s.percentile(0.5)), unit);
+  report_measurement(name + ", p10", rate(s.percentile(0.9)), unit);
+  report_measurement(name + ", p90", rate(s.percentile(0.1)), unit);
+}
+
+/**
+ * @brief Table of measured values printed as a single warning
+ *
+ * Each value is also written to the timing dump as a measurement named
+ * "<title>, <row>, <column>".
+ */
+class table {
+ public:
+  table(const std::string& title, const std::vector<std::string>& columns,
+        const std::string& unit)
+      : title(title), columns(columns), unit(unit) {}
+
+  void add_row(const std::string& row, const std::vector<double>& values) {
+    for (std::size_t i = 0; i < values.size() && i < columns.size(); ++i) {
+      util::get<util::run_statistics>().record_measurement(
+          title + ", " + row + ", " + columns[i], values[i], unit);
+    }
+    rows.emplace_back(row, values);
+  }
+
+  void print() const {
+    std::size_t rowWidth = 0;
+    for (const auto& row : rows) {
+      rowWidth = std::max(rowWidth, row.first.size());
+    }
+    std::ostringstream out;
+    out << title << " (" << unit << ")\n" << std::setw(rowWidth) << "";
+    for (const auto& column : columns) {
+      out << " | " << std::setw(column_width(column)) << column;
+    }
+    for (const auto& row : rows) {
+      out << "\n" << std::setw(rowWidth) << row.first;
+      for (std::size_t i = 0; i < columns.size(); ++i) {
+        out << " | " << std::setw(column_width(columns[i]));
+        if (i < row.second.size()) {
+          out << std::fixed << std::setprecision(3) << row.second[i];
+        } else {
+          out << "-";
+        }
+      }
+    }
+    WARN(out.str());
+  }
+
+ private:
+  static std::size_t column_width(const std::string& column) {
+    constexpr std::size_t min_width = 10;
+    return std::max(min_width, column.size());
+  }
+
+  std::string title;
+  std::vector<std::string> columns;
+  std::string unit;
+  std::vector<std::pair<std::string, std::vector<double>>> rows;
+};
+
+}  // namespace benchmark
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_BENCHMARK_H
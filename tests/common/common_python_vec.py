@@ -216,6 +216,46 @@ swizzle_kernel_template = Template("""
   }
 """)
 
+# Fused variant of the template above: the kernel checks all the swizzles of a
+# vector size at once. A failed device check sets the bit of the swizzle in the
+# failure bitmap, the host decodes it back to the swizzle name.
+swizzle_fused_kernel_template = Template("""
+  {
+    constexpr size_t swizzle_count = ${count};
+    constexpr size_t failure_words = (swizzle_count + 31) / 32;
+    const char *swizzle_names[swizzle_count] = {${names}};
+    ${type} expected_vals[swizzle_count][total_per_element_swizzle_test_cases][${size}] = {
+        ${expected_vals}};
+
+    auto vecBuffer = sycl::buffer<sycl::vec<${type}, ${size}>, 1>(
+        sycl::range<1>(swizzle_count * total_per_element_swizzle_test_cases));
+    std::uint32_t failures[failure_words] = {};
+    {
+      sycl::buffer<std::uint32_t, 1> failureBuffer(
+          failures, sycl::range<1>(failure_words));
+      testQueue.submit([&](sycl::handler &cgh) {
+        sycl::accessor failAcc(failureBuffer, cgh, sycl::read_write);
+        sycl::accessor vecAcc(vecBuffer, cgh, sycl::write_only);
+
+        cgh.single_task<class ${kernelName}>([=]() {
+          ${test}
+        });
+      });
+    }
+
+    auto vecAcc = vecBuffer.get_host_access();
+    for (size_t i = 0; i < swizzle_count; ++i) {
+      INFO("Checking ${vecName}." << swizzle_names[i]);
+      CHECK((failures[i / 32] & (std::uint32_t{1} << (i % 32))) == 0);
+      for (int j = 0; j < total_per_element_swizzle_test_cases; ++j) {
+        CHECK(check_vector_values<${type}, ${size}>(
+            vecAcc[i * total_per_element_swizzle_test_cases + j],
+            expected_vals[i][j]));
+      }
+    }
+  }
+""")
+
 test_func_template = Template("""
 void ${func_name}(util::logger &log) {
 
@@ -468,36 +508,36 @@ class SwizzleData:
             ${type} in_order_reversed_pair_vals[] = {${in_order_pair_vals}};
             ${type} reverse_order_reversed_pair_vals[] = {${reverse_order_pair_vals}};
             if (!check_equal_type_bool<sycl::vec<${type}, ${size}>>(swizzledVec)) {
-                resAcc[0] = false;
+                ${mark_failure}
             }
             if (!check_vector_size<${type}, ${size}>(swizzledVec)) {
-                resAcc[0] = false;
+                ${mark_failure}
             }
             if (!check_vector_values<${type}, ${size}>(swizzledVec, in_order_vals)) {
-                resAcc[0] = false;
+                ${mark_failure}
             }
             if (!check_vector_size_byte_size<${type}, ${size}>(swizzledVec)) {
-                resAcc[0] = false;
+                ${mark_failure}
             }
 #if SYCL_CTS_ENABLE_FULL_CONFORMANCE
             if (!check_convert_as_all_types<${type}, ${size}>(swizzledVec)) {
-                resAcc[0] = false;
+                ${mark_failure}
             }
 #endif // SYCL_CTS_ENABLE_FULL_CONFORMANCE
     """)
 
     lo_hi_odd_even_template = Template(
         """        if (!check_lo_hi_odd_even<${type}>(swizzledVec, in_order_vals)) {
-            resAcc[0] = false;
+            ${mark_failure}
             }
     """)
 
     swizzle_elem_template = Template(
         """
-            vecAcc[in_order] = swizzledVec.template swizzle<${in_order_swiz_indexes}>();
-            vecAcc[reverse_order] = swizzledVec.template swizzle<${reverse_order_swiz_indexes}>();
-            vecAcc[in_order_reversed_pair] = swizzledVec.template swizzle<${in_order_reversed_pair_swiz_indexes}>();
-            vecAcc[reverse_order_reversed_pair] = swizzledVec.template swizzle<${reverse_order_reversed_pair_swiz_indexes}>();
+            vecAcc[${case_offset}in_order] = swizzledVec.template swizzle<${in_order_swiz_indexes}>();
+            vecAcc[${case_offset}reverse_order] = swizzledVec.template swizzle<${reverse_order_swiz_indexes}>();
+            vecAcc[${case_offset}in_order_reversed_pair] = swizzledVec.template swizzle<${in_order_reversed_pair_swiz_indexes}>();
+            vecAcc[${case_offset}reverse_order_reversed_pair] = swizzledVec.template swizzle<${reverse_order_reversed_pair_swiz_indexes}>();
     """)
 
     swizzle_full_test_template = Template(
@@ -571,8 +611,16 @@ class SwizzleData:
 #endif // SYCL_CTS_ENABLE_FULL_CONFORMANCE
     """)
 
-def substitute_swizzles_templates(type_str, size, index_subset, value_subset, convert_type_str, as_type_str):
-    string = ''
+def substitute_swizzle_case(type_str, size, index_subset, value_subset,
+                            convert_type_str, as_type_str, mark_failure,
+                            case_offset):
+    """
+    Generates the device code checking the swizzle given by |index_subset|.
+
+    |mark_failure| is the statement recording a failed check and
+    |case_offset| is the prefix of the indexes of the written vectors.
+    Returns the code, the swizzle name and the expected values.
+    """
     index_list = []
     val_list = []
     for index, value in zip(index_subset, value_subset):
@@ -595,13 +643,15 @@ def substitute_swizzles_templates(type_str, size, index_subset, value_subset, co
         size=size,
         swiz_vals=Data.swizzle_elem_list_dict[size][::-1],
         convert_type=convert_type_str,
-        as_type=as_type_str)
+        as_type=as_type_str,
+        mark_failure=mark_failure)
     if size > 1:
         test_string += SwizzleData.lo_hi_odd_even_template.substitute(
-            type=type_str, size=size)
+            type=type_str, size=size, mark_failure=mark_failure)
     test_string += SwizzleData.swizzle_elem_template.substitute(
         type=type_str,
         size=size,
+        case_offset=case_offset,
         in_order_swiz_indexes=', '.join(
             Data.swizzle_elem_list_dict[size]),
         reverse_order_swiz_indexes=', '.join(
@@ -610,6 +660,13 @@ def substitute_swizzles_templates(type_str, size, index_subset, value_subset, co
             swap_pairs(Data.swizzle_elem_list_dict[size])),
         reverse_order_reversed_pair_swiz_indexes=', '.join(
             swap_pairs(Data.swizzle_elem_list_dict[size][::-1])))
+    return test_string, index_string, val_list
+
+def substitute_swizzles_templates(type_str, size, index_subset, value_subset, convert_type_str, as_type_str):
+    string = ''
+    test_string, index_string, val_list = substitute_swizzle_case(
+        type_str, size, index_subset, value_subset, convert_type_str,
+        as_type_str, 'resAcc[0] = false;', '')
     string += wrap_with_swizzle_kernel(
             type_str, str(size), ', '.join(val_list), ', '.join(val_list[::-1]),
             ', '.join(swap_pairs(val_list)), ', '.join(swap_pairs(val_list[::-1])),
@@ -619,7 +676,57 @@ def substitute_swizzles_templates(type_str, size, index_subset, value_subset, co
         test_string)
     return string
 
-def gen_swizzle_test(type_str, convert_type_str, as_type_str, size):
+def substitute_fused_swizzles_templates(type_str, size, subsets,
+                                        convert_type_str, as_type_str):
+    """
+    Generates a single kernel checking all the swizzles given by |subsets|, a
+    list of (index_subset, value_subset) pairs.
+
+    Each swizzle is identified by its position in the list: the kernel sets the
+    corresponding bit of the failure bitmap if any of its device checks fails
+    and writes its vectors at the position, so the host reports each failure
+    with the swizzle name.
+    """
+    test_string = ''
+    names = []
+    expected_vals = []
+    for case, (index_subset, value_subset) in enumerate(subsets):
+        mark_failure = ('failAcc[' + str(case // 32) + '] |= std::uint32_t{1} << ' +
+                        str(case % 32) + ';')
+        case_offset = str(case) + ' * total_per_element_swizzle_test_cases + '
+        case_string, index_string, val_list = substitute_swizzle_case(
+            type_str, size, index_subset, value_subset, convert_type_str,
+            as_type_str, mark_failure, case_offset)
+        # Each swizzle declares its own variables
+        test_string += '{\n' + case_string + '}\n'
+        names.append('"' + index_string + '"')
+        expected_vals.append('{{' + '}, {'.join([
+            ', '.join(val_list), ', '.join(val_list[::-1]),
+            ', '.join(swap_pairs(val_list)),
+            ', '.join(swap_pairs(val_list[::-1]))]) + '}}')
+
+    return wrap_with_extension_checks(type_str,
+                                      swizzle_fused_kernel_template.substitute(
+                                      kernelName=remove_namespaces_whitespaces(
+                                          'FUSED_KERNEL_' + type_str + str(size)),
+                                      vecName='vec<' + type_str + ', ' + str(size) + '>',
+                                      test=test_string,
+                                      type=type_str,
+                                      size=size,
+                                      count=len(subsets),
+                                      names=', '.join(names),
+                                      expected_vals=',\n        '.join(expected_vals)))
+
+def gen_swizzle_test(type_str, convert_type_str, as_type_str, size,
+                     fused=False):
+    """
+    Generates the tests for the swizzles of the vector of |size| elements.
+
+    By default each of the xyzw and rgba swizzles is checked by its own kernel.
+    If |fused| is set, all of them are checked by a single kernel instead,
+    which reduces the device compilation time and the number of kernel
+    launches. Vectors of more than 4 elements use a single kernel anyway.
+    """
     string = ''
     if size > 4:
         test_string = SwizzleData.swizzle_full_test_template.substitute(
@@ -655,25 +762,29 @@ def gen_swizzle_test(type_str, convert_type_str, as_type_str, size):
             test_string)
         return string
     # size <=4
+    subsets = []
     for length in range(size, size + 1):
-        for index_subset, value_subset in zip(
+        subsets += zip(
                 product(
                     Data.swizzle_xyzw_list_dict[size][:size],
                     repeat=length),
-                product(Data.vals_list_dict[size][:size], repeat=length)):
-            string += substitute_swizzles_templates(type_str, size,
-                    index_subset, value_subset, convert_type_str, as_type_str)
+                product(Data.vals_list_dict[size][:size], repeat=length))
 
     if size == 4:
         for length in range(size, size + 1):
-            for index_subset, value_subset in zip(
+            subsets += zip(
                     product(
                         Data.swizzle_rgba_list_dict[size][:size],
                         repeat=length),
                     product(
-                        Data.vals_list_dict[size][:size], repeat=length)):
-                string += substitute_swizzles_templates(type_str, size,
-                        index_subset, value_subset, convert_type_str, as_type_str)
+                        Data.vals_list_dict[size][:size], repeat=length))
+
+    if fused:
+        return substitute_fused_swizzles_templates(type_str, size, subsets,
+                convert_type_str, as_type_str)
+    for index_subset, value_subset in subsets:
+        string += substitute_swizzles_templates(type_str, size,
+                index_subset, value_subset, convert_type_str, as_type_str)
     return string
 
 
@@ -724,7 +835,7 @@ def get_reverse_type(type_str):
 # Reason for the TODO above is that this function and several more it calls are
 # not really common and only used to generate vector_swizzles test.
 # FIXME: The test (main template and others) should be updated to use Catch2
-def make_swizzles_tests(type_str, input_file, output_file):
+def make_swizzles_tests(type_str, input_file, output_file, fused=False):
     if type_str == 'bool':
         Data.vals_list_dict = cast_to_bool(Data.vals_list_dict)
 
@@ -733,15 +844,15 @@ def make_swizzles_tests(type_str, input_file, output_file):
     convert_type_str = get_reverse_type(type_str)
     as_type_str = get_reverse_type(type_str)
     swizzles[0] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 1)
+                                   as_type_str, 1, fused)
     swizzles[1] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 2)
+                                   as_type_str, 2, fused)
     swizzles[2] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 3)
+                                   as_type_str, 3, fused)
     swizzles[3] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 4)
+                                   as_type_str, 4, fused)
     swizzles[4] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 8)
+                                   as_type_str, 8, fused)
     swizzles[5] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 16)
+                                   as_type_str, 16, fused)
     write_swizzle_source_file(swizzles, input_file, output_file, type_str)
@@ -0,0 +1,319 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+//  Provide the diagnostic context rendered only when Catch2 reports it
+
+#ifndef __SYCLCTS_TESTS_COMMON_DIAGNOSTIC_CONTEXT_H
+#define __SYCLCTS_TESTS_COMMON_DIAGNOSTIC_CONTEXT_H
+
+#include "string_makers.h"
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/internal/catch_source_line_info.hpp>
+#include <catch2/internal/catch_stringref.hpp>
+#include <catch2/internal/catch_unique_name.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace sycl_cts {
+
+/**
+ * @brief Description of the checked combination with the fluent interface of
+ *        section_name, which is only rendered to text on demand
+ * @details The parameters are captured into a fixed-size record without any
+ *          allocation: small trivially copyable values are copied, other
+ *          values are referenced and have to outlive the context. The
+ *          description and the parameter names are expected to be string
+ *          literals. Use with DEFERRED_INFO() and DEFERRED_CHECK() instead of
+ *          passing the rendered text to INFO(), so the text is only produced
+ *          for the assertions Catch2 actually reports.
+ */
+class diagnostic_context {
+ public:
+  static constexpr std::size_t max_parameters = 8;
+
+ private:
+  static constexpr std::size_t max_value_size = 16;
+
+  struct parameter;
+  using render_function = std::string (*)(const parameter&);
+
+  struct parameter {
+    const char* name;
+    render_function render;
+    const void* address;
+    alignas(std::max_align_t) unsigned char storage[max_value_size];
+  };
+
+  template <typename T>
+  static constexpr bool stored_by_value =
+      std::is_trivially_copyable_v<std::decay_t<T>> &&
+      sizeof(std::decay_t<T>) <= max_value_size &&
+      alignof(std::decay_t<T>) <= alignof(std::max_align_t);
+
+  template <typename T>
+  static std::string render(const parameter& p) {
+    using value_type = std::decay_t<T>;
+    const value_type* value;
+    if constexpr (stored_by_value<T>) {
+      value = std::launder(reinterpret_cast<const value_type*>(p.storage));
+    } else {
+      value = static_cast<const value_type*>(p.address);
+    }
+    // Same conversion as section_name::with() to get the same text
+    return Catch::StringMaker<T>::convert(*value);
+  }
+
+  const char* m_description = "";
+  std::array<parameter, max_parameters> m_parameters;
+  std::size_t m_size = 0;
+
+ public:
+  diagnostic_context() = default;
+
+  diagnostic_context(const char* description) : m_description(description) {}
+
+  template <typename T>
+  diagnostic_context& with(const char* name, T&& value) {
+    static_assert(stored_by_value<T> || std::is_lvalue_reference_v<T>,
+                  "Temporary value would not outlive the context");
+    if (m_size == max_parameters) {
+      throw std::length_error("Too many parameters in the diagnostic context");
+    }
+    auto& p = m_parameters[m_size++];
+    p.name = name;
+    p.render = &render<T>;
+    if constexpr (stored_by_value<T>) {
+      new (p.storage) std::decay_t<T>(value);
+    } else {
+      p.address = &value;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Renders the same text as section_name::create() would
+   */
+  std::string create() const {
+    std::string result(m_description);
+    if (m_size > 0) {
+      // remove last comma and re-use first space from parameters
+      result += " with";
+      for (std::size_t i = 0; i < m_size; ++i) {
+        const auto& p = m_parameters[i];
+        result += ' ';
+        result += p.name;
+        result += ": ";
+        result += p.render(p);
+        result += ',';
+      }
+      result += "\b \b";
+    }
+    return result;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Piece of the text appended to a context by DEFERRED_INFO(), either a
+ *        string literal or a string referenced until the scope ends
+ */
+class deferred_info_piece {
+  const char* m_chars = nullptr;
+  const std::string* m_string = nullptr;
+
+ public:
+  deferred_info_piece() = default;
+  deferred_info_piece(const char* chars) : m_chars(chars) {}
+  deferred_info_piece(const std::string& string) : m_string(&string) {}
+  deferred_info_piece(std::string&&) = delete;
+
+  void append_to(std::string& result) const {
+    if (m_string) {
+      result += *m_string;
+    } else if (m_chars) {
+      result += m_chars;
+    }
+  }
+};
+
+/**
+ * @brief Context of an active DEFERRED_INFO() scope with the text following
+ *        it on a separate line
+ */
+struct deferred_info_slot {
+  static constexpr std::size_t max_pieces = 4;
+
+  Catch::SourceLineInfo line_info{"", 0};
+  diagnostic_context context;
+  std::array<deferred_info_piece, max_pieces> pieces;
+  std::size_t piece_count = 0;
+
+  std::string render() const {
+    std::string result = context.create();
+    if (piece_count > 0) {
+      result += '\n';
+      for (std::size_t i = 0; i < piece_count; ++i) {
+        pieces[i].append_to(result);
+      }
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Per-thread arena with the contexts of the active DEFERRED_INFO()
+ *        scopes, the outermost first
+ *
+ * Nothing is registered with Catch2 until a context has to be reported: by
+ * DEFERRED_CHECK() before a failing assertion, or by the scopes left by an
+ * exception.
+ */
+struct deferred_info_stack {
+  static constexpr std::size_t capacity = 16;
+
+  std::array<deferred_info_slot, capacity> slots;
+  std::size_t size = 0;
+  // Number of the outermost slots already registered while unwinding
+  std::size_t unwound = 0;
+
+  static deferred_info_stack& get() {
+    static thread_local deferred_info_stack stack;
+    return stack;
+  }
+
+  /**
+   * @brief Registers the rendered contexts of all active scopes with the next
+   *        assertion, in the order of the scopes
+   */
+  void report() const {
+    for (std::size_t i = 0; i < size; ++i) {
+      UNSCOPED_INFO(slots[i].render());
+    }
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Keeps a diagnostic context active for the enclosing scope, see
+ *        DEFERRED_INFO()
+ */
+class scoped_diagnostic_context {
+  // Used instead of a slot if the scopes are nested too deeply
+  std::optional<Catch::ScopedMessage> m_eager;
+  int m_uncaught_exceptions;
+
+ public:
+  template <typename... PiecesT>
+  scoped_diagnostic_context(const Catch::SourceLineInfo& line_info,
+                            const diagnostic_context& context,
+                            PiecesT&&... pieces)
+      : m_uncaught_exceptions(std::uncaught_exceptions()) {
+    static_assert(sizeof...(PiecesT) <= detail::deferred_info_slot::max_pieces,
+                  "Too many pieces of text in DEFERRED_INFO()");
+    auto& stack = detail::deferred_info_stack::get();
+    if (stack.size < stack.capacity) {
+      auto& slot = stack.slots[stack.size];
+      slot.line_info = line_info;
+      slot.context = context;
+      slot.pieces = {detail::deferred_info_piece(
+          std::forward<PiecesT>(pieces))...};
+      slot.piece_count = sizeof...(PiecesT);
+      ++stack.size;
+    } else {
+      // Too deeply nested to defer, fall back to the behavior of INFO()
+      detail::deferred_info_slot slot;
+      slot.context = context;
+      slot.pieces = {detail::deferred_info_piece(
+          std::forward<PiecesT>(pieces))...};
+      slot.piece_count = sizeof...(PiecesT);
+      m_eager.emplace(Catch::MessageBuilder("DEFERRED_INFO"_catch_sr,
+                                            line_info, Catch::ResultWas::Info)
+                      << slot.render());
+    }
+  }
+
+  scoped_diagnostic_context(const scoped_diagnostic_context&) = delete;
+  scoped_diagnostic_context& operator=(const scoped_diagnostic_context&) =
+      delete;
+
+  ~scoped_diagnostic_context() {
+    if (m_eager) return;
+    auto& stack = detail::deferred_info_stack::get();
+    if (std::uncaught_exceptions() > m_uncaught_exceptions) {
+      // Catch2 reports the messages kept by the scopes left by an exception.
+      // The innermost scope registers the contexts of all scopes, so they
+      // keep their order even though the scopes are left from the inside.
+      // Like the one of INFO(), the message of a scoped message destroyed
+      // during unwinding is not removed.
+      for (; stack.unwound < stack.size; ++stack.unwound) {
+        const auto& slot = stack.slots[stack.unwound];
+        Catch::ScopedMessage message(
+            Catch::MessageBuilder("DEFERRED_INFO"_catch_sr, slot.line_info,
+                                  Catch::ResultWas::Info)
+            << slot.render());
+      }
+    }
+    --stack.size;
+    stack.unwound = std::min(stack.unwound, stack.size);
+  }
+};
+
+}  // namespace sycl_cts
+
+/**
+ * @brief Drop-in for INFO() taking a diagnostic_context, optionally followed
+ *        by string literals and strings appended on a separate line, none of
+ *        which is rendered unless reported
+ * @details The context is reported along with the assertions of
+ *          DEFERRED_CHECK() that fail and with the exceptions leaving the
+ *          scope. The strings are referenced and have to outlive the scope.
+ */
+#define DEFERRED_INFO(...)                                                 \
+  const ::sycl_cts::scoped_diagnostic_context INTERNAL_CATCH_UNIQUE_NAME( \
+      deferredInfo)(CATCH_INTERNAL_LINEINFO, __VA_ARGS__)
+
+/**
+ * @brief CHECK() reporting the contexts of the active DEFERRED_INFO() scopes
+ *        if the condition does not hold
+ * @details The condition is evaluated once more by CHECK() itself, so it must
+ *          not have side effects.
+ */
+#define DEFERRED_CHECK(...)                                    \
+  do {                                                         \
+    if (!static_cast<bool>(__VA_ARGS__)) {                     \
+      ::sycl_cts::detail::deferred_info_stack::get().report(); \
+    }                                                          \
+    CHECK(__VA_ARGS__);                                        \
+  } while (false)
+
+#endif  // __SYCLCTS_TESTS_COMMON_DIAGNOSTIC_CONTEXT_H
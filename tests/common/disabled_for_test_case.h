@@ -11,6 +11,7 @@
 
 // This is required for detecting the active SYCL implementation
 #include "macro_utils.h"
+#include "type_coverage_shard.h"
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <sycl/sycl.hpp>
@@ -100,10 +101,10 @@
 // including those that receive additional parameters.
 // A downside of this is that we require test cases to provide
 // tags, which normally would be optional.
-#define INTERNAL_CTS_DISABLED_TEST_CASE(description, tags, ...) \
-  TEST_CASE(description, tags) {                                \
-    FAIL("This test case has been compile-time disabled.");     \
-  }                                                             \
+#define INTERNAL_CTS_DISABLED_TEST_CASE(description, tags, ...)           \
+  TEST_CASE(description SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX, tags) { \
+    FAIL("This test case has been compile-time disabled.");               \
+  }                                                                       \
   _INTERNAL_CTS_DISCARD
 #define _INTERNAL_CTS_DISCARD(...)
 
@@ -122,22 +123,29 @@
 #define INTERNAL_CTS_MAYBE_DISABLE_TEST_CASE(catchMacroProxy, ...) \
   INTERNAL_CTS_EVAL(INTERNAL_CTS_CHECK_ALL_IMPLS(catchMacroProxy, __VA_ARGS__))
 
-// Define proxies for all supported test macro types
+// Define proxies for all supported test macro types. The description is
+// extended to keep the test case names unique when the source is compiled as
+// several type coverage shards.
 
-#define INTERNAL_CTS_ENABLED_TEST_CASE(...) \
-  TEST_CASE(__VA_ARGS__) INTERNAL_CTS_ENABLED_TEST_CASE_BODY
+#define INTERNAL_CTS_ENABLED_TEST_CASE(description, ...)                       \
+  TEST_CASE(description SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX, __VA_ARGS__) \
+  INTERNAL_CTS_ENABLED_TEST_CASE_BODY
 #define INTERNAL_CTS_DISABLED_FOR_TEST_CASE(...)                       \
   INTERNAL_CTS_MAYBE_DISABLE_TEST_CASE(INTERNAL_CTS_ENABLED_TEST_CASE, \
                                        __VA_ARGS__)
 
-#define INTERNAL_CTS_ENABLED_TEMPLATE_TEST_CASE_SIG(...) \
-  TEMPLATE_TEST_CASE_SIG(__VA_ARGS__) INTERNAL_CTS_ENABLED_TEST_CASE_BODY
+#define INTERNAL_CTS_ENABLED_TEMPLATE_TEST_CASE_SIG(description, ...)          \
+  TEMPLATE_TEST_CASE_SIG(description SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX, \
+                         __VA_ARGS__)                                          \
+  INTERNAL_CTS_ENABLED_TEST_CASE_BODY
 #define INTERNAL_CTS_DISABLED_FOR_TEMPLATE_TEST_CASE_SIG(...) \
   INTERNAL_CTS_MAYBE_DISABLE_TEST_CASE(                       \
       INTERNAL_CTS_ENABLED_TEMPLATE_TEST_CASE_SIG, __VA_ARGS__)
 
-#define INTERNAL_CTS_ENABLED_TEMPLATE_LIST_TEST_CASE(...) \
-  TEMPLATE_LIST_TEST_CASE(__VA_ARGS__) INTERNAL_CTS_ENABLED_TEST_CASE_BODY
+#define INTERNAL_CTS_ENABLED_TEMPLATE_LIST_TEST_CASE(description, ...)   \
+  TEMPLATE_LIST_TEST_CASE(                                               \
+      description SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX, __VA_ARGS__) \
+  INTERNAL_CTS_ENABLED_TEST_CASE_BODY
 #define INTERNAL_CTS_DISABLED_FOR_TEMPLATE_LIST_TEST_CASE(...) \
   INTERNAL_CTS_MAYBE_DISABLE_TEST_CASE(                        \
       INTERNAL_CTS_ENABLED_TEMPLATE_LIST_TEST_CASE, __VA_ARGS__)
@@ -26,6 +26,7 @@
 
 #include "../common/cts_async_handler.h"
 #include "../common/cts_selector.h"
+#include "../../util/run_statistics.h"
 
 #include <cassert>
 
@@ -45,6 +46,16 @@ namespace util {
   async handler
 */
 struct get_cts_object {
+  /**
+    @brief Returns the CTS device, resolved once per run
+    @return Default SYCL device
+  */
+  static sycl::device device() {
+    auto &manager = get<device_manager>();
+    manager.count_avoided_selection();
+    return manager.get_device();
+  }
+
   /**
     @brief Creates a SYCL device
     @param selector Device selector to use to create the device. Uses the CTS
@@ -56,6 +67,16 @@ struct get_cts_object {
     return sycl::device(selector);
   }
 
+  /**
+    @brief Returns the platform of the CTS device, resolved once per run
+    @return Default SYCL platform
+  */
+  static sycl::platform platform() {
+    auto &manager = get<device_manager>();
+    manager.count_avoided_selection();
+    return manager.get_platform();
+  }
+
   /**
     @brief Creates a SYCL platform
     @param selector Device selector to use to create the platform. Uses the CTS
@@ -68,6 +89,25 @@ struct get_cts_object {
     return sycl::platform(selector);
   }
 
+  /**
+    @brief Creates a SYCL queue for the CTS device using the CTS async handler
+    and the context shared by all such queues
+    @return Default SYCL queue
+  */
+  static sycl::queue queue() {
+    static cts_async_handler asyncHandler;
+    auto &manager = get<device_manager>();
+    manager.count_avoided_selection();
+    get<run_statistics>().count_queue_creation();
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+    return sycl::queue(manager.get_context(), manager.get_device(),
+                       asyncHandler, sycl::property_list{});
+#else
+    return sycl::queue(manager.get_device(), asyncHandler,
+                       sycl::property_list{});
+#endif
+  }
+
   /**
     @brief Creates a SYCL queue using the CTS async handler
     @param selector Device selector to use to create the queue. Uses the CTS
@@ -77,6 +117,7 @@ struct get_cts_object {
   template <class DeviceSelector = decltype(cts_selector)>
   static sycl::queue queue(DeviceSelector selector = cts_selector) {
     static cts_async_handler asyncHandler;
+    get<run_statistics>().count_queue_creation();
 #if !SYCL_CTS_COMPILING_WITH_HIPSYCL
     return sycl::queue(selector, asyncHandler, sycl::property_list{});
 #else
@@ -85,6 +126,18 @@ struct get_cts_object {
 #endif
   }
 
+  /**
+    @brief Creates a new SYCL context for the CTS device using the CTS async
+    handler
+    @return Default SYCL context
+  */
+  static sycl::context context() {
+    static cts_async_handler asyncHandler;
+    auto &manager = get<device_manager>();
+    manager.count_avoided_selection();
+    return sycl::context(manager.get_device(), asyncHandler);
+  }
+
   /**
     @brief Creates a SYCL context using the CTS async handler
     @param selector Device selector to use to create the context. Uses the CTS
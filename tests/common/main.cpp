@@ -6,16 +6,25 @@
 //
 *******************************************************************************/
 
+#include <cstdint>
+#include <iostream>
 #include <regex>
 #include <string>
 
 #define CATCH_CONFIG_RUNNER
+#include <catch2/catch_config.hpp>
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/internal/catch_clara.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
 
 #include "./../../util/device_manager.h"
+#include "./../../util/run_statistics.h"
+#include "./../../util/test_options.h"
 #include "cts_selector.h"
+#include "timing_listener.h"
+
+CATCH_REGISTER_LISTENER(sycl_cts::util::timing_listener)
 
 int main(int argc, char** argv) {
   using namespace sycl_cts;
@@ -25,7 +34,15 @@ int main(int argc, char** argv) {
 
   std::string devicePattern;
   std::string infoDumpFile;
+  std::string timingDumpFile;
   bool listDevices = false;
+  auto& options = util::get<util::test_options>();
+  std::uint64_t mathSweepStride = options.get_math_sweep_stride();
+  std::size_t mathSweepChunkSize = options.get_math_sweep_chunk_size();
+  std::size_t maxSubmissionThreads = options.get_max_submission_threads();
+  std::size_t groupAlgorithmsSize = options.get_group_algorithms_size();
+  std::size_t reductionSize = options.get_reduction_size();
+  std::size_t usmMaxBytes = options.get_usm_benchmark_max_bytes();
 
   using namespace Catch::Clara;
 
@@ -37,6 +54,26 @@ int main(int argc, char** argv) {
              Opt(listDevices)["--list-devices"]("List all available devices") |
              Opt(infoDumpFile, "file")["--info-dump"](
                  "Dump platform and device info to file") |
+             Opt(timingDumpFile, "file")["--timing-dump"](
+                 "Dump wall time and queue usage per test case and section "
+                 "to JSON file; defaults to <info-dump>.timing.json") |
+             Opt(mathSweepStride, "stride")["--math-sweep-stride"](
+                 "Distance between float bit patterns evaluated by the math "
+                 "built-ins sweep ([sweep] tag), 1 for an exhaustive sweep") |
+             Opt(mathSweepChunkSize, "values")["--math-sweep-chunk-size"](
+                 "Number of values evaluated by a single kernel launch of "
+                 "the math built-ins sweep") |
+             Opt(maxSubmissionThreads, "threads")["--max-submission-threads"](
+                 "Largest number of host threads submitting at once in the "
+                 "concurrency tests") |
+             Opt(groupAlgorithmsSize, "elements")["--group-algorithms-size"](
+                 "Number of elements processed by each group algorithm in "
+                 "the size-scaled group functions tests ([scaled] tag)") |
+             Opt(reductionSize, "work-items")["--reduction-size"](
+                 "Number of work-items of the large-scale reduction tests "
+                 "([large_scale] tag)") |
+             Opt(usmMaxBytes, "bytes")["--usm-max-bytes"](
+                 "Largest transfer size of the USM bandwidth benchmark") |
              session.cli();
 
   session.cli(cli);
@@ -46,6 +83,41 @@ int main(int argc, char** argv) {
     return returnCode;
   }
 
+  if (mathSweepStride == 0 || mathSweepChunkSize == 0) {
+    std::cerr << "Math built-ins sweep stride and chunk size must be positive"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.set_math_sweep_stride(mathSweepStride);
+  options.set_math_sweep_chunk_size(mathSweepChunkSize);
+
+  if (maxSubmissionThreads == 0) {
+    std::cerr << "Number of submission threads must be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.set_max_submission_threads(maxSubmissionThreads);
+
+  if (groupAlgorithmsSize == 0) {
+    std::cerr << "Size of the group algorithms tests must be positive"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.set_group_algorithms_size(groupAlgorithmsSize);
+
+  if (reductionSize == 0) {
+    std::cerr << "Size of the large-scale reduction tests must be positive"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.set_reduction_size(reductionSize);
+
+  if (usmMaxBytes < 4) {
+    std::cerr << "Largest USM transfer size must be at least 4 bytes"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.set_usm_benchmark_max_bytes(usmMaxBytes);
+
   auto& device_mngr = util::get<util::device_manager>();
   if (!devicePattern.empty()) {
     device_mngr.set_device_regex(std::regex(devicePattern));
@@ -60,5 +132,26 @@ int main(int argc, char** argv) {
     device_mngr.dump_info(infoDumpFile);
   }
 
-  return session.run();
+  if (timingDumpFile.empty() && !infoDumpFile.empty()) {
+    // Place the timing next to the info dump, so the CTest runs collected by
+    // run_conformance_tests.py always provide it
+    const std::string infoSuffix = ".info";
+    timingDumpFile = infoDumpFile;
+    if (timingDumpFile.size() > infoSuffix.size() &&
+        timingDumpFile.compare(timingDumpFile.size() - infoSuffix.size(),
+                               infoSuffix.size(), infoSuffix) == 0) {
+      timingDumpFile.resize(timingDumpFile.size() - infoSuffix.size());
+    }
+    timingDumpFile += ".timing.json";
+  }
+  util::get<util::run_statistics>().set_timing_dump_file(timingDumpFile);
+
+  const int result = session.run();
+
+  if (session.config().verbosity() == Catch::Verbosity::High) {
+    std::cout << "CTS device selector evaluations avoided by caching: "
+              << device_mngr.get_avoided_selector_evaluations() << std::endl;
+  }
+
+  return result;
 }
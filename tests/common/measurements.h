@@ -0,0 +1,50 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+//  Provide the reporting of the values measured by the test cases
+
+#ifndef __SYCLCTS_TESTS_COMMON_MEASUREMENTS_H
+#define __SYCLCTS_TESTS_COMMON_MEASUREMENTS_H
+
+#include "../../util/run_statistics.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+namespace sycl_cts {
+
+/**
+ * @brief Reports a value measured by the running test case
+ *
+ * The value is printed as a warning and written to the timing dump along
+ * with the timing of the test case. Measurements never fail a test case.
+ * Should be called from the main thread only, as Catch2 macros are not
+ * thread-safe.
+ */
+inline void report_measurement(const std::string& name, double value,
+                               const std::string& unit) {
+  util::get<util::run_statistics>().record_measurement(name, value, unit);
+  WARN(name << ": " << value << " " << unit);
+}
+
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_MEASUREMENTS_H
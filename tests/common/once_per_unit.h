@@ -10,6 +10,7 @@
 #define __SYCLCTS_TESTS_COMMON_ONCE_PER_UNIT_H
 
 #include "../../util/logger.h"
+#include "../../util/run_statistics.h"
 #include "../common/get_cts_object.h"
 
 namespace detail {
@@ -28,6 +29,9 @@ namespace {
 /**
  * All symbols have internal linkage here;
  * special attention to the ODR rules should be made
+ *
+ * With SYCL_CTS_UNITY_BUILD_BATCH_SIZE the translation unit is a batch of
+ * test case sources, which share the objects provided here
  */
 namespace once_per_unit {
 /**
@@ -35,6 +39,8 @@ namespace once_per_unit {
  */
 inline sycl::queue &get_queue() {
   static auto q = sycl_cts::util::get_cts_object::queue();
+  sycl_cts::util::get<sycl_cts::util::run_statistics>()
+      .count_shared_queue_request();
   return q;
 }
 
@@ -21,6 +21,8 @@ namespace sycl_cts {
  *          So if you see
  *              "Assertion `m_parent' failed."
  *          that's probably the case.
+ *          For the messages passed to INFO() consider diagnostic_context with
+ *          DEFERRED_INFO() instead, which only renders the text on failure.
  */
 class section_name {
   std::string m_description;
@@ -0,0 +1,204 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides Catch2 listener recording wall time per test case and section
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_TIMING_LISTENER_H
+#define __SYCLCTS_TESTS_COMMON_TIMING_LISTENER_H
+
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+
+#include "../../util/run_statistics.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Records wall time and the calls of the CTS queue helpers per TEST_CASE and
+ * per SECTION, along with the measurements reported by the test cases. The
+ * submissions and host waits themselves are not counted. The results are
+ * written as JSON once the run ends, if a timing dump file was requested.
+ */
+class timing_listener : public Catch::EventListenerBase {
+  using clock_type = std::chrono::steady_clock;
+
+  struct counters {
+    double seconds = 0;
+    std::size_t queues_created = 0;
+    std::size_t shared_queue_requests = 0;
+  };
+
+  struct snapshot {
+    clock_type::time_point start;
+    std::size_t queues_created;
+    std::size_t shared_queue_requests;
+
+    static snapshot now() {
+      const auto& stats = get<run_statistics>();
+      return {clock_type::now(), stats.get_queues_created(),
+              stats.get_shared_queue_requests()};
+    }
+
+    void accumulate_into(counters& c) const {
+      const auto current = now();
+      c.seconds +=
+          std::chrono::duration<double>(current.start - start).count();
+      c.queues_created += current.queues_created - queues_created;
+      c.shared_queue_requests +=
+          current.shared_queue_requests - shared_queue_requests;
+    }
+  };
+
+  struct test_case_record {
+    std::string name;
+    counters total;
+    // Sections in the order of their first execution
+    std::vector<std::string> section_order;
+    std::map<std::string, counters> sections;
+    std::vector<run_statistics::measurement> measurements;
+  };
+
+ public:
+  using Catch::EventListenerBase::EventListenerBase;
+
+  void testCaseStarting(const Catch::TestCaseInfo& info) override {
+    records.push_back({info.name, {}, {}, {}, {}});
+    // Drop the measurements recorded out of any test case
+    get<run_statistics>().take_measurements();
+    test_case_start = snapshot::now();
+  }
+
+  void sectionStarting(const Catch::SectionInfo& info) override {
+    // The outermost section is the test case itself and has an empty path
+    std::string path;
+    if (!open_sections.empty()) {
+      const auto& parent = open_sections.back().first;
+      path = parent.empty() ? info.name : parent + " / " + info.name;
+      auto& record = records.back();
+      if (record.sections.count(path) == 0) {
+        record.section_order.push_back(path);
+        record.sections[path] = {};
+      }
+    }
+    open_sections.push_back({std::move(path), snapshot::now()});
+  }
+
+  void sectionEnded(const Catch::SectionStats&) override {
+    const auto& [path, start] = open_sections.back();
+    if (!path.empty()) {
+      start.accumulate_into(records.back().sections[path]);
+    }
+    open_sections.pop_back();
+  }
+
+  void testCaseEnded(const Catch::TestCaseStats&) override {
+    test_case_start.accumulate_into(records.back().total);
+    records.back().measurements = get<run_statistics>().take_measurements();
+  }
+
+  void testRunEnded(const Catch::TestRunStats&) override {
+    const auto& file = get<run_statistics>().get_timing_dump_file();
+    if (file.empty()) return;
+
+    std::ofstream out(file);
+    out << "{\"test-cases\": [";
+    for (std::size_t i = 0; i < records.size(); ++i) {
+      const auto& record = records[i];
+      out << (i == 0 ? "" : ",") << "\n  {\"name\": " << quoted(record.name)
+          << ", " << fields(record.total) << ", \"sections\": [";
+      for (std::size_t j = 0; j < record.section_order.size(); ++j) {
+        const auto& path = record.section_order[j];
+        out << (j == 0 ? "" : ", ") << "{\"name\": " << quoted(path) << ", "
+            << fields(record.sections.at(path)) << "}";
+      }
+      out << "], \"measurements\": [";
+      for (std::size_t j = 0; j < record.measurements.size(); ++j) {
+        const auto& m = record.measurements[j];
+        char value[32] = "null";
+        if (std::isfinite(m.value)) {
+          std::snprintf(value, sizeof(value), "%.6g", m.value);
+        }
+        out << (j == 0 ? "" : ", ") << "{\"name\": " << quoted(m.name)
+            << ", \"value\": " << value << ", \"unit\": " << quoted(m.unit)
+            << "}";
+      }
+      out << "]}";
+    }
+    out << "\n]}\n";
+  }
+
+ private:
+  static std::string fields(const counters& c) {
+    char seconds[32];
+    std::snprintf(seconds, sizeof(seconds), "%.6f", c.seconds);
+    return std::string("\"seconds\": ") + seconds +
+           ", \"queues-created\": " + std::to_string(c.queues_created) +
+           ", \"shared-queue-requests\": " +
+           std::to_string(c.shared_queue_requests);
+  }
+
+  static std::string quoted(const std::string& str) {
+    std::string result = "\"";
+    for (const char c : str) {
+      switch (c) {
+        case '"':
+          result += "\\\"";
+          break;
+        case '\\':
+          result += "\\\\";
+          break;
+        case '\n':
+          result += "\\n";
+          break;
+        case '\t':
+          result += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            result += escaped;
+          } else {
+            result += c;
+          }
+      }
+    }
+    return result + "\"";
+  }
+
+  std::vector<test_case_record> records;
+  snapshot test_case_start{};
+  std::vector<std::pair<std::string, snapshot>> open_sections;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_TIMING_LISTENER_H
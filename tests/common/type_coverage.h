@@ -25,6 +25,7 @@
 
 #include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -32,6 +33,7 @@
 #include <sycl/sycl.hpp>
 
 #include "../../util/type_traits.h"
+#include "type_coverage_shard.h"
 
 #include "catch2/catch_tostring.hpp"
 
@@ -670,4 +672,38 @@ void for_marrays_of_all_types(const named_type_pack<types...>& typeList,
    ...);
 }
 #endif  // !SYCL_CTS_COMPILING_WITH_HIPSYCL
+
+namespace details {
+template <typename Shard, std::size_t Offset, typename... Types,
+          std::size_t... Indexes>
+auto get_type_pack_shard(const named_type_pack<Types...> &types,
+                         std::index_sequence<Indexes...>) {
+  constexpr std::size_t first = Shard::first(Offset);
+  return named_type_pack<std::tuple_element_t<
+      first + Indexes * Shard::count, std::tuple<Types...>>...>::
+      generate(types.names[first + Indexes * Shard::count]...);
+}
+}  // namespace details
+
+/**
+ * @brief Run action for the part of the types given by named_type_pack
+ *        instance covered by the shard, if any
+ * @tparam Shard Instance of type_coverage_shard selecting the types
+ * @tparam Offset Position of the first type within the whole coverage list,
+ *         for the lists covered by several calls
+ * @tparam Types Deduced from named_type_pack parameter pack for list of types
+ * @tparam ActionT Deduced type of the callable to run
+ * @param types Named type pack instance with type names stored
+ * @param action Callable to run with the named_type_pack of the shard types
+ */
+template <typename Shard, std::size_t Offset = 0, typename... Types,
+          typename ActionT>
+void for_type_pack_shard(const named_type_pack<Types...> &types,
+                         ActionT &&action) {
+  constexpr std::size_t size = Shard::size(sizeof...(Types), Offset);
+  if constexpr (size > 0) {
+    action(details::get_type_pack_shard<Shard, Offset>(
+        types, std::make_index_sequence<size>{}));
+  }
+}
 #endif  // __SYCLCTS_TESTS_COMMON_TYPE_COVERAGE_H
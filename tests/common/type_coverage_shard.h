@@ -0,0 +1,118 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+//  Provide the selection of the type coverage compiled by a translation unit
+//  generated by shard_cts_test_sources()
+
+#ifndef __SYCLCTS_TESTS_COMMON_TYPE_COVERAGE_SHARD_H
+#define __SYCLCTS_TESTS_COMMON_TYPE_COVERAGE_SHARD_H
+
+#include <cstddef>
+
+// Number of translation units the type coverage of the source is split into
+#ifndef SYCL_CTS_TYPE_COVERAGE_SHARD_COUNT
+#define SYCL_CTS_TYPE_COVERAGE_SHARD_COUNT 1
+#endif
+
+// Index of the part of the type coverage compiled by this translation unit
+#ifndef SYCL_CTS_TYPE_COVERAGE_SHARD_INDEX
+#define SYCL_CTS_TYPE_COVERAGE_SHARD_INDEX 0
+#endif
+
+/**
+ * @brief Shard of a type coverage compiled by a single translation unit
+ *
+ * The elements of a coverage list are dealt out round-robin to the shards, so
+ * each of the shards instantiates about the same number of combinations and
+ * every element is covered by exactly one of them.
+ *
+ * @tparam Index Index of the shard, less than Count
+ * @tparam Count Number of shards the coverage is split into
+ */
+template <std::size_t Index, std::size_t Count>
+struct type_coverage_shard {
+  static_assert(Count > 0, "There should be at least one shard");
+  static_assert(Index < Count, "Shard index is out of range");
+
+  static constexpr std::size_t index = Index;
+  static constexpr std::size_t count = Count;
+
+  /**
+   * @brief Checks whether the element with given position in the coverage
+   *        list belongs to this shard
+   */
+  static constexpr bool covers(std::size_t position) {
+    return position % Count == Index;
+  }
+
+  /**
+   * @brief Returns the position of the first element covered by this shard
+   *        within the part of the coverage list starting at offset
+   */
+  static constexpr std::size_t first(std::size_t offset) {
+    return (Index + Count - offset % Count) % Count;
+  }
+
+  /**
+   * @brief Returns the number of elements covered by this shard within the
+   *        part of the coverage list of given size starting at offset
+   */
+  static constexpr std::size_t size(std::size_t listSize, std::size_t offset) {
+    return listSize > first(offset)
+               ? (listSize - first(offset) + Count - 1) / Count
+               : 0;
+  }
+};
+
+/**
+ * @brief Shard covering the whole type coverage
+ */
+using full_type_coverage = type_coverage_shard<0, 1>;
+
+/**
+ * @brief The shard selected for the current translation unit
+ *
+ * Expands to a different type in each of the generated translation units, so
+ * it should be used as a template argument for the functions selecting the
+ * types. This way the functions instantiated by different shards never share
+ * the symbol names.
+ */
+#define SYCL_CTS_TYPE_COVERAGE_SHARD                      \
+  type_coverage_shard<SYCL_CTS_TYPE_COVERAGE_SHARD_INDEX, \
+                      SYCL_CTS_TYPE_COVERAGE_SHARD_COUNT>
+
+#define INTERNAL_CTS_STRINGIFY(x) _INTERNAL_CTS_STRINGIFY(x)
+#define _INTERNAL_CTS_STRINGIFY(x) #x
+
+/**
+ * @brief Suffix of the test case names registered by the translation unit
+ *
+ * Each of the generated translation units registers the test cases of the
+ * source, so the names should be different to keep them unique.
+ */
+#if SYCL_CTS_TYPE_COVERAGE_SHARD_COUNT > 1
+#define SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX                        \
+  " (shard " INTERNAL_CTS_STRINGIFY(SYCL_CTS_TYPE_COVERAGE_SHARD_INDEX) \
+  " of " INTERNAL_CTS_STRINGIFY(SYCL_CTS_TYPE_COVERAGE_SHARD_COUNT) ")"
+#else
+#define SYCL_CTS_TYPE_COVERAGE_SHARD_NAME_SUFFIX ""
+#endif
+
+#endif  // __SYCLCTS_TESTS_COMMON_TYPE_COVERAGE_SHARD_H
@@ -0,0 +1,201 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests for the buffer dependency tracking of the command groups
+//  submitted from multiple host threads
+//
+*******************************************************************************/
+
+#include "concurrency_common.h"
+
+namespace concurrency_buffer {
+using namespace concurrency_common;
+
+constexpr size_t buffer_size = 256;
+
+class disjoint_step_kernel;
+class shared_history_kernel;
+class overlapping_increment_kernel;
+
+/**
+ * Each thread applies a chain of steps to its own buffer, with a host task in
+ * the middle of the chain. The result depends on the order of the steps, so
+ * it is only correct if the commands submitted by the thread execute in the
+ * order of submission.
+ */
+void run_disjoint_buffers(thread_queues& queues, size_t threadCount) {
+  constexpr size_t steps = submissions_per_thread;
+  std::vector<std::vector<unsigned int>> data(threadCount);
+  std::atomic<size_t> hostTaskMismatches{0};
+  {
+    std::vector<sycl::buffer<unsigned int, 1>> buffers;
+    for (size_t t = 0; t < threadCount; ++t) {
+      data[t].assign(buffer_size, static_cast<unsigned int>(t));
+      buffers.emplace_back(data[t].data(), sycl::range<1>(buffer_size));
+    }
+
+    run_in_threads(threadCount, [&](size_t t) {
+      auto& queue = queues[t];
+      auto& buffer = buffers[t];
+      for (size_t step = 0; step < steps; ++step) {
+        const auto stepValue = static_cast<unsigned int>(step);
+        if (step == steps / 2) {
+          const unsigned int expected =
+              apply_steps(static_cast<unsigned int>(t), step);
+          queue.submit([&](sycl::handler& cgh) {
+            sycl::accessor acc(buffer, cgh, sycl::read_write_host_task);
+            cgh.host_task([=, &hostTaskMismatches] {
+              for (size_t i = 0; i < buffer_size; ++i) {
+                if (acc[i] != expected) ++hostTaskMismatches;
+                acc[i] = apply_step(acc[i], stepValue);
+              }
+            });
+          });
+        } else {
+          queue.submit([&](sycl::handler& cgh) {
+            sycl::accessor acc(buffer, cgh, sycl::read_write);
+            cgh.parallel_for<disjoint_step_kernel>(
+                sycl::range<1>(buffer_size), [=](sycl::id<1> id) {
+                  acc[id] = apply_step(acc[id], stepValue);
+                });
+          });
+        }
+      }
+    });
+    queues.wait_and_throw();
+  }
+
+  INFO("Host tasks observed values out of the submission order");
+  CHECK(hostTaskMismatches == 0);
+  for (size_t t = 0; t < threadCount; ++t) {
+    const unsigned int expected =
+        apply_steps(static_cast<unsigned int>(t), steps);
+    const auto mismatches =
+        std::count_if(data[t].begin(), data[t].end(),
+                      [=](unsigned int value) { return value != expected; });
+    INFO("Thread " << t << " has " << mismatches << " wrong values");
+    CHECK(mismatches == 0);
+  }
+}
+
+/**
+ * All threads access the same buffers, each command appends its step to the
+ * history of the submitting thread. The commands of different threads are
+ * serialized by the runtime in any order, while the history of each thread
+ * should follow its submission order.
+ */
+void run_shared_buffers(thread_queues& queues, size_t threadCount) {
+  constexpr size_t steps = submissions_per_thread;
+  std::vector<unsigned int> history(threadCount * steps, 0);
+  std::vector<size_t> cursors(threadCount, 0);
+  std::atomic<size_t> hostTaskMismatches{0};
+  {
+    sycl::buffer<unsigned int, 1> historyBuffer(history.data(),
+                                                sycl::range<1>(history.size()));
+    sycl::buffer<size_t, 1> cursorBuffer(cursors.data(),
+                                         sycl::range<1>(cursors.size()));
+
+    run_in_threads(threadCount, [&](size_t t) {
+      auto& queue = queues[t];
+      for (size_t step = 0; step < steps; ++step) {
+        const auto stepValue = static_cast<unsigned int>(step);
+        if (step == steps / 2) {
+          queue.submit([&](sycl::handler& cgh) {
+            sycl::accessor historyAcc(historyBuffer, cgh,
+                                      sycl::write_only_host_task);
+            sycl::accessor cursorAcc(cursorBuffer, cgh,
+                                     sycl::read_write_host_task);
+            cgh.host_task([=, &hostTaskMismatches] {
+              if (cursorAcc[t] != step) ++hostTaskMismatches;
+              historyAcc[t * steps + cursorAcc[t]++] = stepValue;
+            });
+          });
+        } else {
+          queue.submit([&](sycl::handler& cgh) {
+            sycl::accessor historyAcc(historyBuffer, cgh, sycl::write_only);
+            sycl::accessor cursorAcc(cursorBuffer, cgh, sycl::read_write);
+            cgh.single_task<shared_history_kernel>([=] {
+              historyAcc[t * steps + cursorAcc[t]++] = stepValue;
+            });
+          });
+        }
+      }
+    });
+    queues.wait_and_throw();
+  }
+
+  INFO("Host tasks observed commands out of the submission order");
+  CHECK(hostTaskMismatches == 0);
+  for (size_t t = 0; t < threadCount; ++t) {
+    bool ordered = cursors[t] == steps;
+    for (size_t step = 0; step < steps && ordered; ++step) {
+      ordered = history[t * steps + step] == step;
+    }
+    INFO("Commands of thread " << t << " executed out of order");
+    CHECK(ordered);
+  }
+}
+
+/**
+ * Each thread increments its own range of the buffer, which overlaps with
+ * the ranges of the neighbouring threads. Conflicting accesses of different
+ * threads should be serialized, so no increment is lost.
+ */
+void run_overlapping_ranges(thread_queues& queues, size_t threadCount) {
+  constexpr size_t steps = submissions_per_thread;
+  constexpr size_t chunk = buffer_size / 4;
+  std::vector<unsigned int> data((threadCount + 1) * chunk, 0);
+  {
+    sycl::buffer<unsigned int, 1> buffer(data.data(),
+                                         sycl::range<1>(data.size()));
+
+    run_in_threads(threadCount, [&](size_t t) {
+      auto& queue = queues[t];
+      for (size_t step = 0; step < steps; ++step) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc(buffer, cgh, sycl::range<1>(2 * chunk),
+                             sycl::id<1>(t * chunk), sycl::read_write);
+          cgh.parallel_for<overlapping_increment_kernel>(
+              sycl::range<1>(2 * chunk), [=](sycl::id<1> id) { ++acc[id]; });
+        });
+      }
+    });
+    queues.wait_and_throw();
+  }
+
+  for (size_t c = 0; c <= threadCount; ++c) {
+    // The first and the last chunks are covered by a single thread
+    const bool overlapping = c > 0 && c < threadCount;
+    const unsigned int expected = (overlapping ? 2 : 1) * steps;
+    const auto mismatches = std::count_if(
+        data.begin() + c * chunk, data.begin() + (c + 1) * chunk,
+        [=](unsigned int value) { return value != expected; });
+    INFO("Chunk " << c << " has " << mismatches << " wrong values");
+    CHECK(mismatches == 0);
+  }
+}
+
+TEST_CASE("buffer accesses submitted from multiple threads", "[concurrency]") {
+  SECTION("disjoint buffers") { for_queue_kinds(run_disjoint_buffers); }
+  SECTION("shared buffers") { for_queue_kinds(run_shared_buffers); }
+  SECTION("overlapping ranged accessors") {
+    for_queue_kinds(run_overlapping_ranges);
+  }
+}
+
+}  // namespace concurrency_buffer
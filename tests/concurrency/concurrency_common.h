@@ -0,0 +1,177 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides common code for the tests submitting from multiple host threads
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_CONCURRENCY_COMMON_H
+#define SYCL_CTS_CONCURRENCY_COMMON_H
+
+#include "../../util/test_options.h"
+#include "../common/common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace concurrency_common {
+
+// Number of command groups submitted by each of the threads
+inline constexpr size_t submissions_per_thread = 32;
+
+/**
+ * @brief Returns the largest number of submitting threads, set by the
+ *        `--max-submission-threads` CLI parameter
+ */
+inline size_t get_max_thread_count() {
+  return sycl_cts::util::get<sycl_cts::util::test_options>()
+      .get_max_submission_threads();
+}
+
+/**
+ * @brief Returns the numbers of threads to run the tests with: the powers of
+ *        two up to the largest number of threads, and the largest one
+ */
+inline std::vector<size_t> get_thread_counts() {
+  const size_t maxCount = get_max_thread_count();
+  std::vector<size_t> counts;
+  for (size_t count = 1; count < maxCount; count *= 2) {
+    counts.push_back(count);
+  }
+  counts.push_back(maxCount);
+  return counts;
+}
+
+/**
+ * @brief Calls body(threadIndex) from each of threadCount host threads and
+ *        waits for all of them
+ *
+ * The threads are released at once, so the submissions overlap as much as
+ * possible. Catch2 assertions are not thread-safe, so body should only record
+ * the results for the calling thread to verify. The first exception thrown by
+ * body is rethrown once all threads are joined.
+ */
+template <typename BodyT>
+void run_in_threads(size_t threadCount, const BodyT& body) {
+  std::atomic<bool> start{false};
+  std::mutex errorMutex;
+  std::exception_ptr error;
+
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount);
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t] {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      try {
+        body(t);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) error = std::current_exception();
+      }
+    });
+  }
+  start.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @brief Queues used by the submitting threads: either a single queue shared
+ *        by all of them, or a queue per thread
+ *
+ * All queues are created by the calling thread before the submission starts,
+ * so queue construction is not measured.
+ */
+class thread_queues {
+ public:
+  thread_queues(size_t threadCount, bool shared,
+                const sycl::property_list& properties = {}) {
+    auto queue = sycl_cts::util::get_cts_object::queue();
+    const size_t count = shared ? 1 : threadCount;
+    for (size_t t = 0; t < count; ++t) {
+      queues.emplace_back(queue.get_context(), queue.get_device(),
+                          cts_async_handler{}, properties);
+    }
+  }
+
+  sycl::queue& operator[](size_t threadIndex) {
+    return queues[threadIndex % queues.size()];
+  }
+
+  void wait_and_throw() {
+    for (auto& queue : queues) {
+      queue.wait_and_throw();
+    }
+  }
+
+ private:
+  std::vector<sycl::queue> queues;
+};
+
+/**
+ * @brief Calls test(queues, threadCount) with the largest number of threads,
+ *        in separate sections for a shared queue and for a queue per thread
+ */
+template <typename TestT>
+void for_queue_kinds(const TestT& test,
+                     const sycl::property_list& properties = {}) {
+  const size_t threadCount = get_max_thread_count();
+  INFO("Submitting from " << threadCount << " threads");
+  SECTION("shared queue") {
+    thread_queues queues(threadCount, true, properties);
+    test(queues, threadCount);
+  }
+  SECTION("queue per thread") {
+    thread_queues queues(threadCount, false, properties);
+    test(queues, threadCount);
+  }
+}
+
+/**
+ * @brief Returns the value produced by the n-th step of the chain of
+ *        operations applied by the tests, starting with value
+ *
+ * The operation is not commutative, so the result depends on the order of
+ * the steps.
+ */
+inline unsigned int apply_step(unsigned int value, unsigned int step) {
+  return value * 3u + step;
+}
+
+/**
+ * @brief Returns the value after applying the steps [0, stepCount) in order
+ */
+inline unsigned int apply_steps(unsigned int value, size_t stepCount) {
+  for (size_t step = 0; step < stepCount; ++step) {
+    value = apply_step(value, static_cast<unsigned int>(step));
+  }
+  return value;
+}
+
+}  // namespace concurrency_common
+
+#endif  // SYCL_CTS_CONCURRENCY_COMMON_H
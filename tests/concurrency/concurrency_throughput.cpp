@@ -0,0 +1,94 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurement of the submission throughput as the number of
+//  submitting host threads scales
+//
+*******************************************************************************/
+
+#include "../common/measurements.h"
+#include "concurrency_common.h"
+
+#include <chrono>
+#include <string>
+
+namespace concurrency_throughput {
+using namespace concurrency_common;
+
+using clock_type = std::chrono::steady_clock;
+
+// Number of command groups submitted by each thread for the measurement
+constexpr size_t measured_submissions = 256;
+
+class flag_kernel;
+
+/**
+ * Each thread submits single tasks setting their own flag in the buffer of
+ * the thread, so the commands of different threads are independent. Reports
+ * the number of submissions per second until all submit calls return, and
+ * until all commands complete.
+ */
+void measure(size_t threadCount, bool shared) {
+  thread_queues queues(threadCount, shared);
+  const size_t total = threadCount * measured_submissions;
+  std::vector<int> hostFlags(total, 0);
+  {
+    std::vector<sycl::buffer<int, 1>> buffers;
+    for (size_t t = 0; t < threadCount; ++t) {
+      buffers.emplace_back(hostFlags.data() + t * measured_submissions,
+                           sycl::range<1>(measured_submissions));
+    }
+
+    const auto start = clock_type::now();
+    run_in_threads(threadCount, [&](size_t t) {
+      auto& queue = queues[t];
+      auto& buffer = buffers[t];
+      for (size_t s = 0; s < measured_submissions; ++s) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc(buffer, cgh, sycl::range<1>(1), sycl::id<1>(s),
+                             sycl::write_only);
+          cgh.single_task<flag_kernel>([=] { acc[0] = 1; });
+        });
+      }
+    });
+    const std::chrono::duration<double> submitTime = clock_type::now() - start;
+    queues.wait_and_throw();
+    const std::chrono::duration<double> totalTime = clock_type::now() - start;
+
+    const std::string name =
+        std::string(shared ? "shared queue" : "queue per thread") + ", " +
+        std::to_string(threadCount) + " threads";
+    sycl_cts::report_measurement(name + ", submission",
+                                 total / submitTime.count(), "submissions/s");
+    sycl_cts::report_measurement(name + ", completion",
+                                 total / totalTime.count(), "submissions/s");
+  }
+
+  const auto missing = std::count(hostFlags.begin(), hostFlags.end(), 0);
+  INFO(missing << " of " << total << " commands did not execute");
+  CHECK(missing == 0);
+}
+
+TEST_CASE("submission throughput from multiple threads", "[concurrency]") {
+  for (size_t threadCount : get_thread_counts()) {
+    measure(threadCount, true);
+    measure(threadCount, false);
+  }
+}
+
+}  // namespace concurrency_throughput
@@ -0,0 +1,127 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests for the event dependencies of the USM commands submitted
+//  from multiple host threads
+//
+*******************************************************************************/
+
+#include "concurrency_common.h"
+
+#include <stdexcept>
+
+namespace concurrency_usm {
+using namespace concurrency_common;
+
+constexpr size_t allocation_size = 256;
+
+class usm_step_kernel;
+
+/**
+ * Each thread applies a chain of steps to its own device allocation. In the
+ * middle of the chain the values are copied to host and verified by a host
+ * task. The commands are ordered either by the events of the previous
+ * commands or by an in-order queue.
+ */
+void run_usm_chains(thread_queues& queues, size_t threadCount,
+                    bool explicitDependencies) {
+  constexpr size_t steps = submissions_per_thread;
+  constexpr size_t bytes = allocation_size * sizeof(unsigned int);
+  std::vector<std::vector<unsigned int>> snapshots(
+      threadCount, std::vector<unsigned int>(allocation_size));
+  std::vector<std::vector<unsigned int>> results(
+      threadCount, std::vector<unsigned int>(allocation_size));
+  std::atomic<size_t> hostTaskMismatches{0};
+
+  run_in_threads(threadCount, [&](size_t t) {
+    auto& queue = queues[t];
+    unsigned int* ptr = sycl::malloc_device<unsigned int>(allocation_size,
+                                                          queue);
+    if (ptr == nullptr) {
+      throw std::runtime_error("Device allocation failed");
+    }
+
+    std::vector<sycl::event> deps;
+    auto chain = [&](sycl::event event) {
+      if (explicitDependencies) deps = {event};
+    };
+
+    chain(queue.fill(ptr, static_cast<unsigned int>(t), allocation_size));
+    for (size_t step = 0; step < steps; ++step) {
+      const auto stepValue = static_cast<unsigned int>(step);
+      if (step == steps / 2) {
+        const unsigned int expected =
+            apply_steps(static_cast<unsigned int>(t), step);
+        unsigned int* snapshot = snapshots[t].data();
+        chain(queue.memcpy(snapshot, ptr, bytes, deps));
+        chain(queue.submit([&](sycl::handler& cgh) {
+          cgh.depends_on(deps);
+          cgh.host_task([=, &hostTaskMismatches] {
+            for (size_t i = 0; i < allocation_size; ++i) {
+              if (snapshot[i] != expected) ++hostTaskMismatches;
+            }
+          });
+        }));
+      }
+      chain(queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(deps);
+        cgh.parallel_for<usm_step_kernel>(
+            sycl::range<1>(allocation_size), [=](sycl::id<1> id) {
+              ptr[id[0]] = apply_step(ptr[id[0]], stepValue);
+            });
+      }));
+    }
+    queue.memcpy(results[t].data(), ptr, bytes, deps).wait();
+    sycl::free(ptr, queue);
+  });
+  queues.wait_and_throw();
+
+  INFO("Host tasks observed values out of the submission order");
+  CHECK(hostTaskMismatches == 0);
+  for (size_t t = 0; t < threadCount; ++t) {
+    const unsigned int expected =
+        apply_steps(static_cast<unsigned int>(t), steps);
+    const auto mismatches =
+        std::count_if(results[t].begin(), results[t].end(),
+                      [=](unsigned int value) { return value != expected; });
+    INFO("Thread " << t << " has " << mismatches << " wrong values");
+    CHECK(mismatches == 0);
+  }
+}
+
+TEST_CASE("USM commands submitted from multiple threads", "[concurrency]") {
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+
+  SECTION("event dependencies") {
+    for_queue_kinds([](thread_queues& queues, size_t threadCount) {
+      run_usm_chains(queues, threadCount, true);
+    });
+  }
+  SECTION("in-order queues") {
+    for_queue_kinds(
+        [](thread_queues& queues, size_t threadCount) {
+          run_usm_chains(queues, threadCount, false);
+        },
+        {sycl::property::queue::in_order()});
+  }
+}
+
+}  // namespace concurrency_usm
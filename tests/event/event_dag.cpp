@@ -0,0 +1,96 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests and measurement of large graphs of dependent commands
+//
+*******************************************************************************/
+
+#include "../common/measurements.h"
+#include "event_dag.h"
+
+namespace event_dag {
+
+using namespace sycl_cts;
+
+constexpr dag_shape all_shapes[] = {dag_shape::chain,
+                                    dag_shape::fan_out_fan_in,
+                                    dag_shape::random, dag_shape::independent};
+
+constexpr dependency_kind all_kinds[] = {dependency_kind::events,
+                                         dependency_kind::accessors};
+
+// Graph size of the conformance test
+constexpr size_t test_node_count = 1000;
+
+// Graph sizes of the measurement
+constexpr size_t benchmark_node_counts[] = {10000, 100000};
+
+static sycl::queue get_dag_queue() {
+  auto queue = util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+  return queue;
+}
+
+TEST_CASE("large graphs of commands honor all dependencies", "[event]") {
+  auto queue = get_dag_queue();
+  for (auto kind : all_kinds) {
+    for (auto shape : all_shapes) {
+      const auto graph = make_dag({shape, test_node_count});
+      INFO("Graph: " << to_string(shape) << ", " << graph.node_count()
+                     << " nodes linked by " << to_string(kind));
+      check_dag_run(graph, run_dag(queue, graph, kind));
+    }
+  }
+}
+
+// The measurement is hidden from the default run, it can be selected by the
+// [benchmark] tag.
+TEST_CASE("scheduling overhead of large graphs of commands",
+          "[event][.benchmark]") {
+  auto queue = get_dag_queue();
+  for (auto kind : all_kinds) {
+    for (size_t nodeCount : benchmark_node_counts) {
+      // The graph without dependencies gives the time of the commands alone
+      double baseline = 0;
+      for (auto shape : {dag_shape::independent, dag_shape::chain,
+                         dag_shape::fan_out_fan_in, dag_shape::random}) {
+        const auto graph = make_dag({shape, nodeCount});
+        const std::string name = to_string(shape) + ", " +
+                                 std::to_string(nodeCount) + " nodes, " +
+                                 to_string(kind);
+        INFO("Graph: " << name);
+        const auto run = run_dag(queue, graph, kind);
+        check_dag_run(graph, run);
+
+        const double submitPerNode = run.submit_time.count() / nodeCount;
+        const double totalPerNode = run.total_time.count() / nodeCount;
+        if (shape == dag_shape::independent) baseline = totalPerNode;
+        report_measurement(name + ", submission latency", submitPerNode * 1e6,
+                           "us/node");
+        report_measurement(name + ", completion time", totalPerNode * 1e6,
+                           "us/node");
+        report_measurement(name + ", scheduling overhead",
+                           (totalPerNode - baseline) * 1e6, "us/node");
+      }
+    }
+  }
+}
+
+}  // namespace event_dag
@@ -0,0 +1,278 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_EVENT_EVENT_DAG_H
+#define SYCL_CTS_EVENT_EVENT_DAG_H
+
+#include "../common/common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace event_dag {
+
+enum class dag_shape {
+  // Each node depends on the previous one
+  chain,
+  // All nodes depend on the first one, the last one depends on all others
+  fan_out_fan_in,
+  // Each node depends on random nodes submitted shortly before it
+  random,
+  // No dependencies, used as a baseline for the scheduling overhead
+  independent
+};
+
+inline std::string to_string(dag_shape shape) {
+  switch (shape) {
+    case dag_shape::chain:
+      return "chain";
+    case dag_shape::fan_out_fan_in:
+      return "fan-out/fan-in";
+    case dag_shape::random:
+      return "random";
+    case dag_shape::independent:
+      return "independent";
+  }
+  return "unknown";
+}
+
+// The way the edges of the graph are passed to the runtime
+enum class dependency_kind {
+  // handler::depends_on() with the events of the predecessors
+  events,
+  // Accessors to the buffers written by the predecessors
+  accessors
+};
+
+inline std::string to_string(dependency_kind kind) {
+  return kind == dependency_kind::events ? "depends_on" : "accessors";
+}
+
+struct dag_parameters {
+  dag_shape shape;
+  size_t node_count;
+  // Random graphs only: the largest number of predecessors of a node, and
+  // the number of preceding nodes they are chosen from
+  size_t max_predecessors = 4;
+  size_t window = 64;
+  std::uint32_t seed = 0;
+};
+
+/**
+ * @brief Directed acyclic graph of commands, nodes are numbered in a
+ *        topological order
+ */
+struct dag {
+  std::vector<std::vector<size_t>> predecessors;
+
+  size_t node_count() const { return predecessors.size(); }
+
+  size_t edge_count() const {
+    size_t count = 0;
+    for (const auto& nodePredecessors : predecessors) {
+      count += nodePredecessors.size();
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Generates a graph of the given shape and size, the same parameters
+ *        always give the same graph
+ */
+inline dag make_dag(const dag_parameters& params) {
+  dag graph;
+  graph.predecessors.resize(params.node_count);
+  const size_t n = params.node_count;
+  switch (params.shape) {
+    case dag_shape::chain:
+      for (size_t v = 1; v < n; ++v) {
+        graph.predecessors[v].push_back(v - 1);
+      }
+      break;
+    case dag_shape::fan_out_fan_in:
+      for (size_t v = 1; v + 1 < n; ++v) {
+        graph.predecessors[v].push_back(0);
+      }
+      if (n > 1) {
+        auto& last = graph.predecessors[n - 1];
+        for (size_t v = (n > 2 ? 1 : 0); v + 1 < n; ++v) {
+          last.push_back(v);
+        }
+      }
+      break;
+    case dag_shape::random: {
+      std::mt19937 generator(params.seed);
+      for (size_t v = 1; v < n; ++v) {
+        const size_t first = v > params.window ? v - params.window : 0;
+        std::uniform_int_distribution<size_t> node(first, v - 1);
+        std::uniform_int_distribution<size_t> degree(1,
+                                                     params.max_predecessors);
+        auto& nodePredecessors = graph.predecessors[v];
+        for (size_t i = degree(generator); i > 0; --i) {
+          nodePredecessors.push_back(node(generator));
+        }
+        std::sort(nodePredecessors.begin(), nodePredecessors.end());
+        nodePredecessors.erase(
+            std::unique(nodePredecessors.begin(), nodePredecessors.end()),
+            nodePredecessors.end());
+      }
+      break;
+    }
+    case dag_shape::independent:
+      break;
+  }
+  return graph;
+}
+
+class dag_node_kernel;
+
+struct dag_run {
+  // Position of each node in the order of execution
+  std::vector<std::uint32_t> order;
+  // Time until all commands are submitted
+  std::chrono::duration<double> submit_time{};
+  // Time until all commands complete
+  std::chrono::duration<double> total_time{};
+};
+
+/**
+ * @brief Submits a command per node of the graph and waits for them
+ *
+ * Each command takes a timestamp from a counter in USM device memory, so the
+ * timestamps give the order the commands started executing in. Requires
+ * device USM allocations.
+ */
+inline dag_run run_dag(sycl::queue& queue, const dag& graph,
+                       dependency_kind kind) {
+  const size_t n = graph.node_count();
+  auto* counter = sycl::malloc_device<std::uint32_t>(1, queue);
+  auto* order = sycl::malloc_device<std::uint32_t>(n, queue);
+  queue.memset(counter, 0, sizeof(std::uint32_t));
+  queue.memset(order, 0xFF, n * sizeof(std::uint32_t));
+  queue.wait_and_throw();
+
+  using read_accessor = sycl::accessor<int, 1, sycl::access_mode::read>;
+  using write_accessor = sycl::accessor<int, 1, sycl::access_mode::write>;
+  std::vector<sycl::buffer<int, 1>> buffers;
+  if (kind == dependency_kind::accessors) {
+    buffers.reserve(n);
+    for (size_t v = 0; v < n; ++v) {
+      buffers.emplace_back(sycl::range<1>(1));
+    }
+  }
+  std::vector<sycl::event> events;
+  events.reserve(n);
+
+  dag_run result;
+  using clock_type = std::chrono::steady_clock;
+  const auto start = clock_type::now();
+  for (size_t v = 0; v < n; ++v) {
+    events.push_back(queue.submit([&](sycl::handler& cgh) {
+      if (kind == dependency_kind::events) {
+        std::vector<sycl::event> dependencies;
+        dependencies.reserve(graph.predecessors[v].size());
+        for (size_t u : graph.predecessors[v]) {
+          dependencies.push_back(events[u]);
+        }
+        cgh.depends_on(dependencies);
+      } else {
+        // Placeholder accessors register the dependencies without being
+        // captured by the kernel
+        for (size_t u : graph.predecessors[v]) {
+          read_accessor predecessor(buffers[u]);
+          cgh.require(predecessor);
+        }
+        write_accessor self(buffers[v]);
+        cgh.require(self);
+      }
+      const auto node = static_cast<std::uint32_t>(v);
+      cgh.single_task<dag_node_kernel>([=] {
+        sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                         sycl::memory_scope::device,
+                         sycl::access::address_space::global_space>
+            timestamp(*counter);
+        order[node] = timestamp.fetch_add(1u);
+      });
+    }));
+  }
+  result.submit_time = clock_type::now() - start;
+  queue.wait_and_throw();
+  result.total_time = clock_type::now() - start;
+
+  result.order.resize(n);
+  queue.memcpy(result.order.data(), order, n * sizeof(std::uint32_t)).wait();
+  sycl::free(order, queue);
+  sycl::free(counter, queue);
+  return result;
+}
+
+struct dag_verification {
+  size_t missing_nodes = 0;
+  size_t violated_edges = 0;
+  // The first violated edge, if any, as (predecessor, successor)
+  std::pair<size_t, size_t> first_violation{};
+};
+
+/**
+ * @brief Checks that every node executed once, after all its predecessors
+ */
+inline dag_verification verify_dag(const dag& graph,
+                                   const std::vector<std::uint32_t>& order) {
+  dag_verification result;
+  const size_t n = graph.node_count();
+  std::vector<char> seen(n, 0);
+  for (size_t v = 0; v < n; ++v) {
+    if (order[v] >= n || seen[order[v]]) {
+      ++result.missing_nodes;
+    } else {
+      seen[order[v]] = 1;
+    }
+    for (size_t u : graph.predecessors[v]) {
+      if (order[u] < order[v]) continue;
+      if (result.violated_edges++ == 0) result.first_violation = {u, v};
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Checks the result of the run, logging the first failure
+ */
+inline void check_dag_run(const dag& graph, const dag_run& run) {
+  const auto verification = verify_dag(graph, run.order);
+  INFO(verification.missing_nodes << " of " << graph.node_count()
+                                  << " nodes did not execute exactly once");
+  CHECK(verification.missing_nodes == 0);
+  INFO(verification.violated_edges
+       << " of " << graph.edge_count() << " edges were not honored, first: "
+       << verification.first_violation.first << " -> "
+       << verification.first_violation.second);
+  CHECK(verification.violated_edges == 0);
+}
+
+}  // namespace event_dag
+
+#endif  // SYCL_CTS_EVENT_EVENT_DAG_H
@@ -0,0 +1,286 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides common code for the tests of the group algorithms over large
+//  inputs spread across many work-groups
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_GROUP_ALGORITHMS_SCALED_H
+#define SYCL_CTS_GROUP_ALGORITHMS_SCALED_H
+
+#include "../../util/test_options.h"
+#include "../../util/thread_pool.h"
+#include "../common/benchmark.h"
+#include "group_functions_common.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace group_algorithms_scaled {
+
+// Largest work-group size used, also bounded by the device limit
+constexpr size_t max_work_group_size = 256;
+
+// Number of elements processed by each work-group of the joint algorithms,
+// in multiples of the work-group size
+constexpr size_t joint_chunk_factor = 16;
+
+/**
+ * @brief Returns the input value of the element
+ *
+ * Values are small, so all results of the tested operators are exactly
+ * representable for the floating point types and do not depend on the order
+ * of the evaluation.
+ */
+template <typename T>
+T input_value(size_t index) {
+  return static_cast<T>((static_cast<std::uint32_t>(index) * 2654435761u) >>
+                        29);
+}
+
+/**
+ * @brief Input and output of an algorithm, and the problem decomposition
+ */
+template <typename T>
+struct scaled_data {
+  scaled_data(sycl::queue& queue, size_t chunkFactor) {
+    const auto& device = queue.get_device();
+    workGroupSize = std::min(
+        max_work_group_size,
+        device.get_info<sycl::info::device::max_work_group_size>());
+    chunkSize = workGroupSize * chunkFactor;
+    const size_t requested =
+        sycl_cts::util::get<sycl_cts::util::test_options>()
+            .get_group_algorithms_size();
+    groupCount = std::max<size_t>(1, requested / chunkSize);
+    size = groupCount * chunkSize;
+
+    input.resize(size);
+    sycl_cts::util::get<sycl_cts::util::thread_pool>().parallel_for(
+        size, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) input[i] = input_value<T>(i);
+        });
+  }
+
+  size_t workGroupSize;
+  size_t chunkSize;
+  size_t groupCount;
+  size_t size;
+  std::vector<T> input;
+};
+
+/**
+ * @brief Returns the wall time of the command group, excluding the kernel
+ *        compilation and the transfer of the input
+ */
+template <typename SubmitT>
+double measure(sycl::queue& queue, const SubmitT& submit) {
+  return sycl_cts::benchmark::time_warm_call([&] {
+           queue.submit(submit).wait_and_throw();
+         })
+      .count();
+}
+
+/**
+ * @brief Compares each of the chunks of the output with the reference
+ *        computed by verifyChunk(chunkIndex, mismatches), in parallel
+ */
+template <typename VerifyT>
+void check_chunks(const std::string& name, size_t chunkCount,
+                  const VerifyT& verifyChunk) {
+  std::atomic<size_t> mismatches{0};
+  sycl_cts::util::get<sycl_cts::util::thread_pool>().parallel_for(
+      chunkCount, [&](size_t begin, size_t end) {
+        size_t local = 0;
+        for (size_t c = begin; c < end; ++c) local += verifyChunk(c);
+        mismatches += local;
+      });
+  INFO(name << ": " << mismatches << " results differ from the reference");
+  CHECK(mismatches == 0);
+}
+
+template <typename T, typename OpT>
+class scaled_reduce_over_group_kernel;
+template <typename T, typename OpT>
+class scaled_joint_reduce_kernel;
+template <typename T, typename OpT>
+class scaled_inclusive_scan_over_group_kernel;
+template <typename T, typename OpT>
+class scaled_joint_exclusive_scan_kernel;
+
+template <typename T, typename OpT>
+void reduce_over_group(sycl::queue& queue, const std::string& name) {
+  scaled_data<T> data(queue, 1);
+  const size_t wgSize = data.workGroupSize;
+  std::vector<T> output(data.groupCount);
+  double seconds = 0;
+  {
+    sycl::buffer<T, 1> in(data.input.data(), sycl::range<1>(data.size));
+    sycl::buffer<T, 1> out(output.data(), sycl::range<1>(output.size()));
+    seconds = measure(queue, [&](sycl::handler& cgh) {
+      sycl::accessor inAcc(in, cgh, sycl::read_only);
+      sycl::accessor outAcc(out, cgh, sycl::write_only, sycl::no_init);
+      cgh.parallel_for<scaled_reduce_over_group_kernel<T, OpT>>(
+          sycl::nd_range<1>(data.size, wgSize), [=](sycl::nd_item<1> item) {
+            const T reduced = sycl::reduce_over_group(
+                item.get_group(), inAcc[item.get_global_id()], OpT());
+            if (item.get_local_id(0) == 0) {
+              outAcc[item.get_group_linear_id()] = reduced;
+            }
+          });
+    });
+  }
+  sycl_cts::report_measurement(name, data.size / seconds, "elements/s");
+  check_chunks(name, data.groupCount, [&](size_t g) -> size_t {
+    T expected = data.input[g * wgSize];
+    for (size_t i = 1; i < wgSize; ++i) {
+      expected = OpT()(expected, data.input[g * wgSize + i]);
+    }
+    return output[g] == expected ? 0 : 1;
+  });
+}
+
+template <typename T, typename OpT>
+void joint_reduce(sycl::queue& queue, const std::string& name) {
+  scaled_data<T> data(queue, joint_chunk_factor);
+  const size_t chunkSize = data.chunkSize;
+  std::vector<T> output(data.groupCount);
+  double seconds = 0;
+  {
+    sycl::buffer<T, 1> in(data.input.data(), sycl::range<1>(data.size));
+    sycl::buffer<T, 1> out(output.data(), sycl::range<1>(output.size()));
+    seconds = measure(queue, [&](sycl::handler& cgh) {
+      sycl::accessor inAcc(in, cgh, sycl::read_only);
+      sycl::accessor outAcc(out, cgh, sycl::write_only, sycl::no_init);
+      cgh.parallel_for<scaled_joint_reduce_kernel<T, OpT>>(
+          sycl::nd_range<1>(data.groupCount * data.workGroupSize,
+                            data.workGroupSize),
+          [=](sycl::nd_item<1> item) {
+            const size_t g = item.get_group_linear_id();
+            const T* first = inAcc.get_pointer() + g * chunkSize;
+            const T reduced = sycl::joint_reduce(
+                item.get_group(), first, first + chunkSize, OpT());
+            if (item.get_local_id(0) == 0) outAcc[g] = reduced;
+          });
+    });
+  }
+  sycl_cts::report_measurement(name, data.size / seconds, "elements/s");
+  check_chunks(name, data.groupCount, [&](size_t g) -> size_t {
+    T expected = data.input[g * chunkSize];
+    for (size_t i = 1; i < chunkSize; ++i) {
+      expected = OpT()(expected, data.input[g * chunkSize + i]);
+    }
+    return output[g] == expected ? 0 : 1;
+  });
+}
+
+template <typename T, typename OpT>
+void inclusive_scan_over_group(sycl::queue& queue, const std::string& name) {
+  scaled_data<T> data(queue, 1);
+  const size_t wgSize = data.workGroupSize;
+  std::vector<T> output(data.size);
+  double seconds = 0;
+  {
+    sycl::buffer<T, 1> in(data.input.data(), sycl::range<1>(data.size));
+    sycl::buffer<T, 1> out(output.data(), sycl::range<1>(data.size));
+    seconds = measure(queue, [&](sycl::handler& cgh) {
+      sycl::accessor inAcc(in, cgh, sycl::read_only);
+      sycl::accessor outAcc(out, cgh, sycl::write_only, sycl::no_init);
+      cgh.parallel_for<scaled_inclusive_scan_over_group_kernel<T, OpT>>(
+          sycl::nd_range<1>(data.size, wgSize), [=](sycl::nd_item<1> item) {
+            outAcc[item.get_global_id()] = sycl::inclusive_scan_over_group(
+                item.get_group(), inAcc[item.get_global_id()], OpT());
+          });
+    });
+  }
+  sycl_cts::report_measurement(name, data.size / seconds, "elements/s");
+  check_chunks(name, data.groupCount, [&](size_t g) -> size_t {
+    size_t mismatches = 0;
+    T expected = data.input[g * wgSize];
+    for (size_t i = 0; i < wgSize; ++i) {
+      const size_t index = g * wgSize + i;
+      if (i > 0) expected = OpT()(expected, data.input[index]);
+      if (output[index] != expected) ++mismatches;
+    }
+    return mismatches;
+  });
+}
+
+template <typename T, typename OpT>
+void joint_exclusive_scan(sycl::queue& queue, const std::string& name) {
+  scaled_data<T> data(queue, joint_chunk_factor);
+  const size_t chunkSize = data.chunkSize;
+  std::vector<T> output(data.size);
+  double seconds = 0;
+  {
+    sycl::buffer<T, 1> in(data.input.data(), sycl::range<1>(data.size));
+    sycl::buffer<T, 1> out(output.data(), sycl::range<1>(data.size));
+    seconds = measure(queue, [&](sycl::handler& cgh) {
+      sycl::accessor inAcc(in, cgh, sycl::read_only);
+      sycl::accessor outAcc(out, cgh, sycl::write_only, sycl::no_init);
+      cgh.parallel_for<scaled_joint_exclusive_scan_kernel<T, OpT>>(
+          sycl::nd_range<1>(data.groupCount * data.workGroupSize,
+                            data.workGroupSize),
+          [=](sycl::nd_item<1> item) {
+            const size_t offset = item.get_group_linear_id() * chunkSize;
+            const T* first = inAcc.get_pointer() + offset;
+            T* result = outAcc.get_pointer() + offset;
+            sycl::joint_exclusive_scan(item.get_group(), first,
+                                       first + chunkSize, result, OpT());
+          });
+    });
+  }
+  sycl_cts::report_measurement(name, data.size / seconds, "elements/s");
+  check_chunks(name, data.groupCount, [&](size_t g) -> size_t {
+    size_t mismatches = 0;
+    T expected = sycl::known_identity_v<OpT, T>;
+    for (size_t i = 0; i < chunkSize; ++i) {
+      const size_t index = g * chunkSize + i;
+      if (output[index] != expected) ++mismatches;
+      expected = OpT()(expected, data.input[index]);
+    }
+    return mismatches;
+  });
+}
+
+template <typename T, typename OpT>
+void run_all_algorithms(sycl::queue& queue, const std::string& typeName,
+                        const std::string& opName) {
+  const std::string suffix = ", " + typeName + ", " + opName;
+  reduce_over_group<T, OpT>(queue, "reduce_over_group" + suffix);
+  joint_reduce<T, OpT>(queue, "joint_reduce" + suffix);
+  inclusive_scan_over_group<T, OpT>(queue,
+                                    "inclusive_scan_over_group" + suffix);
+  joint_exclusive_scan<T, OpT>(queue, "joint_exclusive_scan" + suffix);
+}
+
+template <typename T>
+void run_all_operators(sycl::queue& queue, const std::string& typeName) {
+  run_all_algorithms<T, sycl::plus<T>>(queue, typeName, "plus");
+  run_all_algorithms<T, sycl::maximum<T>>(queue, typeName, "maximum");
+  if constexpr (std::is_integral_v<T>) {
+    run_all_algorithms<T, sycl::bit_xor<T>>(queue, typeName, "bit_xor");
+  }
+}
+
+}  // namespace group_algorithms_scaled
+
+#endif  // SYCL_CTS_GROUP_ALGORITHMS_SCALED_H
@@ -0,0 +1,40 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests of the group algorithms over large inputs spread across
+//  many work-groups, along with their throughput
+//
+*******************************************************************************/
+
+#include "group_algorithms_scaled.h"
+
+namespace group_algorithms_scaled {
+
+TEST_CASE("double group algorithms over large inputs",
+          "[group_func][fp64][.scaled]") {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp64)) {
+    SKIP(
+        "Device does not support double precision floating point "
+        "operations.");
+  }
+
+  run_all_operators<double>(queue, "double");
+}
+
+}  // namespace group_algorithms_scaled
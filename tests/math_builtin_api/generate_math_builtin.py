@@ -74,7 +74,7 @@ def write_cases_to_file(generated_test_cases, inputFile, outputFile, extension=N
     with open(outputFile, 'w+') as output:
         output.write(newSource)
 
-def create_tests(test_id, types, signatures, kind, template, file_name, check = False):
+def create_tests(test_id, types, signatures, kind, template, file_name, check = False, batch_size = 0):
     expanded_signatures =  test_generator.expand_signatures(types, signatures)
 
     # Extensions should be placed on separate files.
@@ -91,13 +91,13 @@ def create_tests(test_id, types, signatures, kind, template, file_name, check =
         base_signatures.append(sig)
 
     if base_signatures and kind == 'base':
-        generated_base_test_cases = test_generator.generate_test_cases(test_id, types, base_signatures, check)
+        generated_base_test_cases = test_generator.generate_test_cases(test_id, types, base_signatures, check, batch_size)
         write_cases_to_file(generated_base_test_cases, template, file_name)
     elif half_signatures and kind == 'half':
-        generated_half_test_cases = test_generator.generate_test_cases(test_id + 300000, types, half_signatures, check)
+        generated_half_test_cases = test_generator.generate_test_cases(test_id + 300000, types, half_signatures, check, batch_size)
         write_cases_to_file(generated_half_test_cases, template, file_name, "fp16")
     elif double_signatures and kind == 'double':
-        generated_double_test_cases = test_generator.generate_test_cases(test_id + 600000, types, double_signatures, check)
+        generated_double_test_cases = test_generator.generate_test_cases(test_id + 600000, types, double_signatures, check, batch_size)
         write_cases_to_file(generated_double_test_cases, template, file_name, "fp64")
     else:
         print("No %s overloads to generate for the test category" % kind)
@@ -126,6 +126,12 @@ def main():
         choices=['true', 'false'],
         default='false',
         help='Generate tests with marray function arguments')
+    argparser.add_argument(
+        '-batch',
+        type=int,
+        default=0,
+        metavar='<cases per kernel>',
+        help='Evaluate up to this number of test cases in a single kernel launch (0 disables batching)')
     argparser.add_argument(
         '-o',
         dest="output",
@@ -147,31 +153,31 @@ def main():
 
     if args.test == 'integer':
         integer_signatures = sycl_functions.create_integer_signatures()
-        create_tests(0, expanded_types, integer_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(0, expanded_types, integer_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'common':
         common_signatures = sycl_functions.create_common_signatures()
-        create_tests(1000000, expanded_types, common_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(1000000, expanded_types, common_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'geometric':
         geomteric_signatures = sycl_functions.create_geometric_signatures()
-        create_tests(2000000, expanded_types, geomteric_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(2000000, expanded_types, geomteric_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'relational':
         relational_signatures = sycl_functions.create_relational_signatures()
-        create_tests(3000000, expanded_types, relational_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(3000000, expanded_types, relational_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'float':
         float_signatures = sycl_functions.create_float_signatures()
-        create_tests(4000000, expanded_types, float_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(4000000, expanded_types, float_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'native':
         native_signatures = sycl_functions.create_native_signatures()
-        create_tests(5000000, expanded_types, native_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(5000000, expanded_types, native_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
     if args.test == 'half':
         half_signatures = sycl_functions.create_half_signatures()
-        create_tests(6000000, expanded_types, half_signatures, args.variante, args.template, args.output, verifyResults)
+        create_tests(6000000, expanded_types, half_signatures, args.variante, args.template, args.output, verifyResults, args.batch)
 
 if __name__ == "__main__":
     main()
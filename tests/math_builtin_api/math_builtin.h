@@ -26,8 +26,11 @@
 #include "../../util/math_reference.h"
 #include "../../util/sycl_exceptions.h"
 #include "../common/once_per_unit.h"
+#include <algorithm>
 #include <cfloat>
 #include <limits>
+#include <tuple>
+#include <utility>
 
 template <int T>
 class kernel;
@@ -83,12 +86,15 @@ template <typename T>
 bool verify(sycl_cts::util::logger& log, T a, T b, int accuracy,
             const std::string& comment);
 
+/**
+ * @brief Checks the value against the reference without logging anything,
+ *        using the same rules as verify() does
+ */
 template <typename T>
 typename std::enable_if<std::is_floating_point<T>::value ||
                             std::is_same<sycl::half, T>::value,
                         bool>::type
-verify(sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r,
-       int accuracy, const std::string& comment) {
+matches_reference(T value, const sycl_cts::resultRef<T>& r, int accuracy) {
   const T reference = r.res;
 
   if (!r.undefined.empty())
@@ -112,7 +118,18 @@ verify(sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r,
 
     if (difference <= differenceExpected) return true;
   }
+  return false;
+}
 
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value ||
+                            std::is_same<sycl::half, T>::value,
+                        bool>::type
+verify(sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r,
+       int accuracy, const std::string& comment) {
+  if (matches_reference(value, r, accuracy)) return true;
+
+  const T reference = r.res;
   log.note("value: " + printable(value) +
            ", reference: " + printable(reference));
   std::string msg = "Expected accuracy in ULP: " + std::to_string(accuracy);
@@ -318,6 +335,128 @@ void check_function_multi_ptr_local(sycl_cts::util::logger& log, funT fun,
                   ". Correctness check for ptr failed.");
 }
 
+/**
+ * @brief Single math built-in invocation to be verified as a part of the batch
+ * @tparam N Test case identifier, used for the failure messages
+ * @tparam returnT Type of the value returned by the built-in
+ * @tparam funT Type of the functor invoking the built-in
+ */
+template <int N, typename returnT, typename funT>
+struct math_builtin_case {
+  static constexpr int id = N;
+  using return_type = returnT;
+
+  funT fun;
+  sycl_cts::resultRef<returnT> ref;
+  int accuracy;
+  std::string comment;
+};
+
+template <int N, typename returnT, typename funT>
+math_builtin_case<N, returnT, funT> make_math_builtin_case(
+    funT fun, sycl_cts::resultRef<returnT> ref, int accuracy = 0,
+    const std::string& comment = {}) {
+  return {fun, ref, accuracy, comment};
+}
+
+/**
+ * @brief Device-copyable storage for the results of all invocations within
+ *        the batch, each work-item writes into its own member only
+ */
+template <typename... T>
+struct batch_results;
+
+template <>
+struct batch_results<> {};
+
+template <typename Head, typename... Tail>
+struct batch_results<Head, Tail...> {
+  Head value;
+  batch_results<Tail...> rest;
+};
+
+template <size_t I, typename Head, typename... Tail>
+auto& get_batch_result(batch_results<Head, Tail...>& results) {
+  if constexpr (I == 0) {
+    return results.value;
+  } else {
+    return get_batch_result<I - 1>(results.rest);
+  }
+}
+
+template <size_t I, typename resultsT, typename funsT>
+void run_batched_case(size_t index, resultsT& results, const funsT& funs) {
+  if (index == I) {
+    value_operations::assign(get_batch_result<I>(results), std::get<I>(funs)());
+  }
+}
+
+template <size_t I, typename resultsT, typename casesT>
+void verify_batched_case(sycl_cts::util::logger& log, resultsT& results,
+                         const casesT& cases) {
+  const auto& c = std::get<I>(cases);
+  const std::string testCase = "tests case: " + std::to_string(c.id);
+
+  if (!verify(log, get_batch_result<I>(results), c.ref, c.accuracy, c.comment))
+    FAIL(log, testCase + ". Correctness check failed.");
+
+  // host check
+  auto hostRes = c.fun();
+  INFO(testCase + ". Correctness check failed on host.");
+  // SYCL 2020 specification sets no requirements for math built-ins accuracy
+  // on host, hence passing negative value to 'verify' helper to indicate that.
+  CHECK(verify(log, hostRes, c.ref, -1, c.comment));
+}
+
+template <typename... casesT, size_t... I>
+void check_function_batch_impl(sycl_cts::util::logger& log,
+                               std::index_sequence<I...>,
+                               const casesT&... cases) {
+  using results_t = batch_results<typename casesT::return_type...>;
+  constexpr int firstId = std::min({casesT::id...});
+  constexpr size_t batchSize = sizeof...(casesT);
+
+  const auto allCases = std::tie(cases...);
+  const auto funs = std::make_tuple(cases.fun...);
+  results_t kernelResults;
+  auto&& testQueue = once_per_unit::get_queue();
+  try {
+    sycl::buffer<results_t, 1> buffer(&kernelResults, sycl::range<1>(1));
+    testQueue.submit([&](sycl::handler& h) {
+      auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
+      h.parallel_for<kernel<firstId>>(
+          sycl::range<1>(batchSize), [=](sycl::item<1> item) {
+            const size_t index = item.get_linear_id();
+            (run_batched_case<I>(index, resultPtr[0], funs), ...);
+          });
+    });
+  } catch (const sycl::exception& e) {
+    log_exception(log, e);
+    std::string errorMsg = "tests cases: " + std::to_string(firstId) + ".." +
+                           std::to_string(firstId + batchSize - 1) +
+                           " a SYCL exception was caught: " + e.what();
+    FAIL(log, errorMsg.c_str());
+  }
+
+  (verify_batched_case<I>(log, kernelResults, allCases), ...);
+}
+
+/**
+ * @brief Verifies a batch of math built-in invocations using a single kernel
+ *        launch and a single host synchronization
+ *
+ * Each work-item evaluates one case into its own slot of the results buffer;
+ * all results are verified on host afterwards, case by case, with the same
+ * diagnostics as check_function() provides.
+ */
+template <typename... casesT>
+void check_function_batch(sycl_cts::util::logger& log,
+                          const casesT&... cases) {
+  static_assert(sizeof...(casesT) > 0, "Empty batch of math built-in cases");
+  check_function_batch_impl(log, std::index_sequence_for<casesT...>{},
+                            cases...);
+}
+
 template <int T, typename returnT, typename funT>
 void test_function(funT fun) {
   sycl::range<1> ndRng(1);
@@ -0,0 +1,35 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "math_builtin_sweep.h"
+
+namespace math_builtin_sweep_float {
+
+// The sweep is hidden from the default run, it can be selected by the
+// [sweep] tag. Use --math-sweep-stride 1 for the exhaustive sweep.
+TEST_CASE("float math built-ins sweep", "[math_builtin_api][.sweep]") {
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto stride = sycl_cts::util::get<sycl_cts::util::test_options>()
+                          .get_math_sweep_stride();
+
+  math_builtin_sweep::run_sweep_for_all_functions<float>(queue, stride);
+}
+
+}  // namespace math_builtin_sweep_float
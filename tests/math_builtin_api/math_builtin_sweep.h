@@ -0,0 +1,235 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides sweep of the unary floating point math built-ins over the bit
+//  patterns of the argument type
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_MATH_BUILTIN_API_MATH_BUILTIN_SWEEP_H
+#define SYCL_CTS_MATH_BUILTIN_API_MATH_BUILTIN_SWEEP_H
+
+#include "../../util/math_reference_batch.h"
+#include "../../util/test_options.h"
+#include "../common/common.h"
+#include "math_builtin.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace math_builtin_sweep {
+
+/**
+ * @brief Defines a functor which invokes the SYCL built-in on device and the
+ *        reference implementation on host, along with the accuracy in ULP
+ *        required by the SYCL 2020 specification
+ */
+#define MATH_BUILTIN_SWEEP_FUNCTION(NAME, ACCURACY)                   \
+  struct NAME##_function {                                            \
+    static constexpr const char* name = #NAME;                        \
+    static constexpr int accuracy = ACCURACY;                         \
+    template <typename T>                                             \
+    T operator()(T x) const {                                         \
+      return sycl::NAME(x);                                           \
+    }                                                                 \
+    template <typename T>                                             \
+    static sycl_cts::resultRef<T> host_reference(T x) {               \
+      return reference::NAME(x);                                      \
+    }                                                                 \
+  };
+
+MATH_BUILTIN_SWEEP_FUNCTION(acos, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(acosh, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(acospi, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(asin, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(asinh, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(asinpi, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(atan, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(atanh, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(atanpi, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(cbrt, 2)
+MATH_BUILTIN_SWEEP_FUNCTION(ceil, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(cos, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(cosh, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(cospi, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(erfc, 16)
+MATH_BUILTIN_SWEEP_FUNCTION(erf, 16)
+MATH_BUILTIN_SWEEP_FUNCTION(exp, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(exp2, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(exp10, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(expm1, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(fabs, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(floor, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(log, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(log2, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(log10, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(log1p, 2)
+MATH_BUILTIN_SWEEP_FUNCTION(logb, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(rint, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(round, 0)
+MATH_BUILTIN_SWEEP_FUNCTION(rsqrt, 2)
+MATH_BUILTIN_SWEEP_FUNCTION(sin, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(sinh, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(sinpi, 4)
+MATH_BUILTIN_SWEEP_FUNCTION(sqrt, 3)
+MATH_BUILTIN_SWEEP_FUNCTION(tan, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(tanh, 5)
+MATH_BUILTIN_SWEEP_FUNCTION(tanpi, 6)
+MATH_BUILTIN_SWEEP_FUNCTION(tgamma, 16)
+MATH_BUILTIN_SWEEP_FUNCTION(trunc, 0)
+
+#undef MATH_BUILTIN_SWEEP_FUNCTION
+
+// Only the first failures are logged in details to keep the output readable
+inline constexpr size_t max_reported_failures = 8;
+
+template <typename T, typename FunctionT>
+class sweep_kernel;
+
+/**
+ * @brief Evaluates the built-in for every stride-th bit pattern of T and
+ *        checks the results against the host reference
+ *
+ * Values are evaluated in chunks, each chunk is submitted before the results
+ * of the previous one are verified on host, so device execution overlaps
+ * with the host verification and memory usage is bounded by the chunk size.
+ *
+ * @return The number of values which do not match the reference
+ */
+template <typename T, typename FunctionT>
+std::uint64_t sweep(sycl_cts::util::logger& log, sycl::queue& queue,
+                    std::uint64_t stride, size_t chunkSize,
+                    std::uint64_t& valueCount) {
+  using bits_t = typename base<T>::type;
+  constexpr std::uint64_t patternCount = std::uint64_t{1}
+                                         << (sizeof(bits_t) * 8);
+  valueCount = (patternCount + stride - 1) / stride;
+
+  struct chunk {
+    std::uint64_t first = 0;
+    size_t count = 0;
+    std::vector<T> results;
+    std::optional<sycl::buffer<T, 1>> buffer;
+  };
+  chunk chunks[2];
+
+  auto submit = [&](chunk& c, std::uint64_t first) {
+    c.first = first;
+    c.count = static_cast<size_t>(
+        std::min<std::uint64_t>(chunkSize, valueCount - first));
+    c.results.resize(c.count);
+    c.buffer.emplace(c.results.data(), sycl::range<1>(c.count));
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc(*c.buffer, cgh, sycl::write_only, sycl::no_init);
+      cgh.parallel_for<sweep_kernel<T, FunctionT>>(
+          sycl::range<1>(c.count), [=](sycl::id<1> id) {
+            const auto pattern = static_cast<bits_t>((first + id[0]) * stride);
+            acc[id] = FunctionT{}(sycl::bit_cast<T>(pattern));
+          });
+    });
+  };
+
+  std::uint64_t failures = 0;
+  auto verify_chunk = [&](chunk& c) {
+    // Destroying the buffer waits for the kernel and copies results back
+    c.buffer.reset();
+
+    std::vector<T> inputs(c.count);
+    for (size_t i = 0; i < c.count; ++i) {
+      const auto pattern = static_cast<bits_t>((c.first + i) * stride);
+      inputs[i] = sycl::bit_cast<T>(pattern);
+    }
+    // The host reference is the most expensive part of the sweep, so it is
+    // evaluated on all host threads
+    std::vector<char> matches(c.count);
+    reference::eval_batch(
+        [](T result, T input) -> char {
+          return matches_reference(result, FunctionT::host_reference(input),
+                                   FunctionT::accuracy);
+        },
+        matches, c.results, inputs);
+
+    for (size_t i = 0; i < c.count; ++i) {
+      if (matches[i]) continue;
+      if (++failures <= max_reported_failures) {
+        log.note(std::string(FunctionT::name) + "(" + printable(inputs[i]) +
+                 ")");
+        verify(log, c.results[i], FunctionT::host_reference(inputs[i]),
+               FunctionT::accuracy, {});
+      }
+    }
+  };
+
+  size_t current = 0;
+  submit(chunks[current], 0);
+  for (std::uint64_t next = chunkSize; next < valueCount; next += chunkSize) {
+    submit(chunks[1 - current], next);
+    verify_chunk(chunks[current]);
+    current = 1 - current;
+  }
+  verify_chunk(chunks[current]);
+  return failures;
+}
+
+/**
+ * @brief Runs the sweep for each of the given built-ins, reporting every
+ *        built-in with values out of the required accuracy
+ */
+template <typename T, typename... FunctionsT>
+void run_sweep(sycl::queue& queue, std::uint64_t stride) {
+  sycl_cts::util::logger log;
+  const size_t chunkSize =
+      sycl_cts::util::get<sycl_cts::util::test_options>()
+          .get_math_sweep_chunk_size();
+
+  auto run_function = [&](auto function) {
+    using FunctionT = decltype(function);
+    std::uint64_t valueCount = 0;
+    const std::uint64_t failures =
+        sweep<T, FunctionT>(log, queue, stride, chunkSize, valueCount);
+    INFO("sycl::" << FunctionT::name << ": " << failures << " of "
+                  << valueCount << " values are out of "
+                  << FunctionT::accuracy << " ULP accuracy");
+    CHECK(failures == 0);
+  };
+  (run_function(FunctionsT{}), ...);
+}
+
+/**
+ * @brief Runs the sweep for all supported unary built-ins
+ */
+template <typename T>
+void run_sweep_for_all_functions(sycl::queue& queue, std::uint64_t stride) {
+  run_sweep<T, acos_function, acosh_function, acospi_function, asin_function,
+            asinh_function, asinpi_function, atan_function, atanh_function,
+            atanpi_function, cbrt_function, ceil_function, cos_function,
+            cosh_function, cospi_function, erfc_function, erf_function,
+            exp_function, exp2_function, exp10_function, expm1_function,
+            fabs_function, floor_function, log_function, log2_function,
+            log10_function, log1p_function, logb_function, rint_function,
+            round_function, rsqrt_function, sin_function, sinh_function,
+            sinpi_function, sqrt_function, tan_function, tanh_function,
+            tanpi_function, tgamma_function, trunc_function>(queue, stride);
+}
+
+}  // namespace math_builtin_sweep
+
+#endif  // SYCL_CTS_MATH_BUILTIN_API_MATH_BUILTIN_SWEEP_H
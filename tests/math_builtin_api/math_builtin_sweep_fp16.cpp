@@ -0,0 +1,38 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "math_builtin_sweep.h"
+
+namespace math_builtin_sweep_fp16 {
+
+// The sweep is hidden from the default run, it can be selected by the
+// [sweep] tag. All 2^16 bit patterns are always evaluated for sycl::half.
+TEST_CASE("sycl::half math built-ins sweep", "[math_builtin_api][.sweep]") {
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::fp16)) {
+    SKIP(
+        "Device does not support half precision floating point "
+        "operations.");
+  }
+
+  math_builtin_sweep::run_sweep_for_all_functions<sycl::half>(queue, 1);
+}
+
+}  // namespace math_builtin_sweep_fp16
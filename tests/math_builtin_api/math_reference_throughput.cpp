@@ -0,0 +1,105 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides throughput measurement of the host reference for math built-ins
+//
+*******************************************************************************/
+
+#include "../common/measurements.h"
+#include "math_builtin_sweep.h"
+
+#include <chrono>
+#include <string>
+
+namespace math_reference_throughput {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t value_count = 1 << 22;
+
+template <typename FunctionT>
+void measure(const std::vector<float>& inputs) {
+  std::vector<float> sequential(inputs.size());
+  std::vector<float> batched(inputs.size());
+  const auto hostReference = [](float x) -> float {
+    return FunctionT::host_reference(x).res;
+  };
+
+  const auto sequentialStart = clock_type::now();
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    sequential[i] = hostReference(inputs[i]);
+  }
+  const std::chrono::duration<double> sequentialTime =
+      clock_type::now() - sequentialStart;
+
+  const auto batchedStart = clock_type::now();
+  reference::eval_batch(hostReference, batched, inputs);
+  const std::chrono::duration<double> batchedTime =
+      clock_type::now() - batchedStart;
+
+  const std::string name = FunctionT::name;
+  sycl_cts::report_measurement(name + ", sequential",
+                               inputs.size() / sequentialTime.count(),
+                               "values/s");
+  sycl_cts::report_measurement(name + ", eval_batch",
+                               inputs.size() / batchedTime.count(),
+                               "values/s");
+
+  // Batched evaluation must not change the results
+  const bool sameResults =
+      std::equal(sequential.begin(), sequential.end(), batched.begin(),
+                 [](float a, float b) {
+                   return sycl::bit_cast<std::uint32_t>(a) ==
+                          sycl::bit_cast<std::uint32_t>(b);
+                 });
+  INFO("Batched reference for " << FunctionT::name
+                                << " differs from the sequential one");
+  CHECK(sameResults);
+}
+
+// The measurement is hidden from the default run, it can be selected by the
+// [benchmark] tag.
+TEST_CASE("math built-ins host reference throughput",
+          "[math_builtin_api][.benchmark]") {
+  using namespace math_builtin_sweep;
+
+  // Evenly spread float bit patterns, covering all the exponent range
+  std::vector<float> inputs(value_count);
+  const std::uint64_t stride = (std::uint64_t{1} << 32) / value_count;
+  for (size_t i = 0; i < value_count; ++i) {
+    inputs[i] = sycl::bit_cast<float>(static_cast<std::uint32_t>(i * stride));
+  }
+
+  sycl_cts::report_measurement(
+      "host threads",
+      static_cast<double>(sycl_cts::util::get<sycl_cts::util::thread_pool>()
+                              .get_concurrency()),
+      "threads");
+  measure<sin_function>(inputs);
+  measure<cos_function>(inputs);
+  measure<tan_function>(inputs);
+  measure<exp_function>(inputs);
+  measure<log_function>(inputs);
+  measure<sqrt_function>(inputs);
+  measure<acospi_function>(inputs);
+  measure<sinpi_function>(inputs);
+  measure<erf_function>(inputs);
+  measure<tgamma_function>(inputs);
+}
+
+}  // namespace math_reference_throughput
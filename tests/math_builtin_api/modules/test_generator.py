@@ -77,6 +77,21 @@ test_case_templates_check = {
 """)
 }
 
+test_case_batch_template = ("""
+{
+  check_function_batch(log,$CASES);
+}
+""")
+
+test_case_batch_entry_template = ("""
+      make_math_builtin_case<$TEST_ID, $RETURN_TYPE>(
+          [=]{
+            $FUNCTION_CALL
+          },
+          []() -> sycl_cts::resultRef<$RETURN_TYPE> {
+            $REFERENCE
+          }()$ACCURACY$COMMENT)""")
+
 def generate_value(base_type, dim):
     val = ""
     for i in range(dim):
@@ -280,15 +295,18 @@ def generate_reference_ptr(types, sig, arg_names, arg_src):
         arg_type=sig.arg_types[-1].name)
     return fc
 
-def generate_test_case(test_id, types, sig, memory, check, decorated = ""):
-    testCaseSource = test_case_templates_check[memory] if check else test_case_templates[memory]
-    testCaseId = str(test_id)
-    (arg_names, arg_src) = generate_arguments(sig, memory, decorated)
-    testCaseSource = testCaseSource.replace("$REFERENCE", generate_reference(sig, arg_names, arg_src))
-    testCaseSource = testCaseSource.replace("$PTR_REF", generate_reference_ptr(types, sig, arg_names, arg_src))
-    testCaseSource = testCaseSource.replace("$TEST_ID", testCaseId)
-    testCaseSource = testCaseSource.replace("$FUNCTION_PRIVATE_CALL", generate_function_private_call(sig, arg_names, arg_src, types))
-    testCaseSource = testCaseSource.replace("$RETURN_TYPE", sig.ret_type.name)
+reference_batch_template = Template("""
+            ${arg_src}
+            return reference::${func_name}(${arg_names});
+""")
+def generate_reference_batch(sig, arg_names, arg_src):
+    fc = reference_batch_template.substitute(
+        arg_src=arg_src,
+        func_name=sig.name,
+        arg_names=",".join(arg_names))
+    return fc
+
+def substitute_accuracy(testCaseSource, sig):
     if sig.accuracy:##If the signature contains an accuracy value
         accuracy = sig.accuracy
         # if accuracy depends on vecSize
@@ -302,6 +320,28 @@ def generate_test_case(test_id, types, sig, memory, check, decorated = ""):
         testCaseSource = testCaseSource.replace("$COMMENT", ', "' + sig.comment +'"')
     else:
         testCaseSource = testCaseSource.replace("$COMMENT", "")
+    return testCaseSource
+
+def generate_batch_entry(test_id, types, sig):
+    testCaseSource = test_case_batch_entry_template
+    (arg_names, arg_src) = generate_arguments(sig, "no_ptr", "")
+    testCaseSource = testCaseSource.replace("$REFERENCE", generate_reference_batch(sig, arg_names, arg_src))
+    testCaseSource = testCaseSource.replace("$TEST_ID", str(test_id))
+    testCaseSource = testCaseSource.replace("$RETURN_TYPE", sig.ret_type.name)
+    testCaseSource = substitute_accuracy(testCaseSource, sig)
+    testCaseSource = testCaseSource.replace("$FUNCTION_CALL", generate_function_call(sig, arg_names, arg_src))
+    return testCaseSource
+
+def generate_test_case(test_id, types, sig, memory, check, decorated = ""):
+    testCaseSource = test_case_templates_check[memory] if check else test_case_templates[memory]
+    testCaseId = str(test_id)
+    (arg_names, arg_src) = generate_arguments(sig, memory, decorated)
+    testCaseSource = testCaseSource.replace("$REFERENCE", generate_reference(sig, arg_names, arg_src))
+    testCaseSource = testCaseSource.replace("$PTR_REF", generate_reference_ptr(types, sig, arg_names, arg_src))
+    testCaseSource = testCaseSource.replace("$TEST_ID", testCaseId)
+    testCaseSource = testCaseSource.replace("$FUNCTION_PRIVATE_CALL", generate_function_private_call(sig, arg_names, arg_src, types))
+    testCaseSource = testCaseSource.replace("$RETURN_TYPE", sig.ret_type.name)
+    testCaseSource = substitute_accuracy(testCaseSource, sig)
 
     if memory != "private" and memory !="no_ptr":
         # We rely on the fact that all SYCL math builtins have at most one arguments as pointer.
@@ -319,9 +359,21 @@ def generate_test_case(test_id, types, sig, memory, check, decorated = ""):
     testCaseSource = testCaseSource.replace("$FUNCTION_CALL", generate_function_call(sig, arg_names, arg_src))
     return testCaseSource
 
-def generate_test_cases(test_id, types, sig_list, check):
+def flush_batch(batch):
+    if not batch:
+        return ""
+    return test_case_batch_template.replace("$CASES", ",".join(batch))
+
+def generate_test_cases(test_id, types, sig_list, check, batch_size = 0):
+    """
+    Generates the source of all test cases for the given signatures.
+    If batch_size is positive, checked cases without pointer arguments are
+    grouped into batches of up to batch_size cases, each batch being
+    evaluated by a single kernel launch.
+    """
     random.seed(0)
     test_source = ""
+    batch = []
     decorated_yes = "sycl::access::decorated::yes"
     decorated_no = "sycl::access::decorated::no"
     for sig in sig_list:
@@ -339,12 +391,19 @@ def generate_test_cases(test_id, types, sig_list, check):
             test_source += generate_test_case(test_id, types, sig, "global", check, decorated_yes)
             test_id += 1
         else:
-            if check:
+            if check and batch_size > 0:
+                batch.append(generate_batch_entry(test_id, types, sig))
+                test_id += 1
+                if len(batch) == batch_size:
+                    test_source += flush_batch(batch)
+                    batch = []
+            elif check:
                 test_source += generate_test_case(test_id, types, sig, "no_ptr", check)
                 test_id += 1
             else:
                 test_source += generate_test_case(test_id, types, sig, "private", check)
                 test_id += 1
+    test_source += flush_batch(batch)
     return test_source
 
 # Lists of the types with equal sizes
@@ -198,8 +198,9 @@ struct check_reducer_subscript {
 
     using OperatorT = sycl::plus<AccumulatorT>;
 
-    bool has_aspect =
-        queue.get_device().has(sycl::aspect::usm_shared_allocations);
+    bool has_aspect = sycl_cts::util::get<sycl_cts::util::device_manager>()
+                          .get_capabilities(queue.get_device())
+                          .has(sycl::aspect::usm_shared_allocations);
     if (!has_aspect) {
       WARN(
           "Device does not support accessing to unified shared memory "
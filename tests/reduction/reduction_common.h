@@ -222,8 +222,9 @@ auto get_buffer() {
  *          current device
  */
 static inline void check_usm_shared_aspect(sycl::queue& queue) {
-  bool has_aspect =
-      queue.get_device().has(sycl::aspect::usm_shared_allocations);
+  bool has_aspect = sycl_cts::util::get<sycl_cts::util::device_manager>()
+                        .get_capabilities(queue.get_device())
+                        .has(sycl::aspect::usm_shared_allocations);
 
   if (!has_aspect) {
     SKIP(
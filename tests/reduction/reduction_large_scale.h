@@ -0,0 +1,372 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides common code for reduction tests over many work-groups
+//
+*******************************************************************************/
+
+#ifndef __SYCL_CTS_TEST_REDUCTION_LARGE_SCALE_H
+#define __SYCL_CTS_TEST_REDUCTION_LARGE_SCALE_H
+
+#include "../../util/test_options.h"
+#include "../../util/thread_pool.h"
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/type_coverage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace reduction_large_scale {
+
+// Work-group size of the nd_range kernels, also bounded by the device limit
+constexpr size_t max_work_group_size = 256;
+
+/** @brief Returns the number of work-items set by the `--reduction-size` CLI
+ *         parameter
+ */
+inline size_t get_size() {
+  return sycl_cts::util::get<sycl_cts::util::test_options>()
+      .get_reduction_size();
+}
+
+/** @brief Generates the input value of each work-item for the operator
+ *
+ *  Values are computed from the work-item index on device and on host, so no
+ *  memory is needed for the input of even 10^9 work-items. The values of the
+ *  sum and the product of the integral types are sparse, so no combination of
+ *  them overflows whatever the order of the reduction is.
+ *  @tparam VariableT Type of the reduction variable
+ *  @tparam FunctorT The type of the functor with which the test runs
+ */
+// The factors of the floating point products are 1 +- 1 / product_step
+constexpr int product_step = 4096;
+
+template <typename VariableT, typename FunctorT>
+struct input_generator {
+  // Distance between the work-items with a significant value
+  size_t stride = 1;
+
+  explicit input_generator(size_t count) {
+    if constexpr (std::is_integral_v<VariableT>) {
+      // Number of significant values that cannot overflow
+      std::uint64_t limit = std::numeric_limits<std::uint64_t>::max();
+      if constexpr (std::is_same_v<FunctorT, sycl::plus<VariableT>>) {
+        limit = std::numeric_limits<VariableT>::max();
+      } else if constexpr (std::is_same_v<FunctorT,
+                                          sycl::multiplies<VariableT>>) {
+        limit = std::numeric_limits<VariableT>::digits - 1;
+      } else if constexpr (std::is_same_v<FunctorT,
+                                          sycl::bit_and<VariableT>> ||
+                           std::is_same_v<FunctorT, sycl::bit_or<VariableT>>) {
+        limit = bits;
+      }
+      if (count > limit) stride = (count + limit - 1) / limit;
+    }
+  }
+
+  VariableT operator()(size_t index) const {
+    const std::uint32_t hash = static_cast<std::uint32_t>(index) * 2654435761u;
+    const bool significant = index % stride == 0;
+    // Position of the bit changed by the significant values
+    const unsigned bit = static_cast<unsigned>((index / stride) % bits);
+
+    if constexpr (std::is_floating_point_v<VariableT>) {
+      if constexpr (std::is_same_v<FunctorT, sycl::multiplies<VariableT>>) {
+        // Random walk around 1 to keep the product in the range of VariableT
+        return VariableT(1) + ((hash >> 31) ? VariableT(1) : VariableT(-1)) /
+                                  VariableT(product_step);
+      } else if constexpr (std::is_same_v<FunctorT, sycl::plus<VariableT>>) {
+        // Both signs in [-1, 1), so the rounding errors do not all add up
+        // and the sum suffers from cancellation
+        return static_cast<VariableT>(static_cast<std::int32_t>(hash) >> 8) /
+               VariableT(1 << 23);
+      } else {
+        return static_cast<VariableT>(static_cast<int>(hash % 101) - 50);
+      }
+    } else if constexpr (std::is_same_v<FunctorT, sycl::plus<VariableT>>) {
+      return significant ? VariableT(1) : VariableT(0);
+    } else if constexpr (std::is_same_v<FunctorT,
+                                        sycl::multiplies<VariableT>>) {
+      return significant ? VariableT(2) : VariableT(1);
+    } else if constexpr (std::is_same_v<FunctorT, sycl::bit_and<VariableT>>) {
+      return significant ? static_cast<VariableT>(~(std::uint64_t{1} << bit))
+                         : static_cast<VariableT>(~std::uint64_t{0});
+    } else if constexpr (std::is_same_v<FunctorT, sycl::bit_or<VariableT>>) {
+      return significant ? static_cast<VariableT>(std::uint64_t{1} << bit)
+                         : VariableT(0);
+    } else if constexpr (std::is_same_v<FunctorT, sycl::bit_xor<VariableT>>) {
+      return static_cast<VariableT>(hash);
+    } else {
+      return static_cast<VariableT>(static_cast<int>(hash % 101) - 50);
+    }
+  }
+
+ private:
+  static constexpr unsigned bits = sizeof(VariableT) * 8;
+};
+
+/** @brief Result of the host reference
+ */
+template <typename VariableT>
+struct reference_result {
+  // Result for the integral types and for minimum and maximum, which do not
+  // depend on the order of the operations
+  VariableT exact;
+  // Result evaluated in long double
+  long double value;
+  // Sum of the magnitudes of the inputs, for the error bound of the sum
+  long double magnitude;
+};
+
+/** @brief Evaluates the reduction of the inputs on all host threads
+ */
+template <typename VariableT, typename FunctorT>
+reference_result<VariableT> get_reference(
+    const input_generator<VariableT, FunctorT>& input, size_t count) {
+  constexpr bool floating_sum =
+      std::is_floating_point_v<VariableT> &&
+      (std::is_same_v<FunctorT, sycl::plus<VariableT>> ||
+       std::is_same_v<FunctorT, sycl::multiplies<VariableT>>);
+  using accumulator_t =
+      std::conditional_t<floating_sum, long double, VariableT>;
+  using combine_t = std::conditional_t<
+      floating_sum,
+      std::conditional_t<std::is_same_v<FunctorT, sycl::plus<VariableT>>,
+                         std::plus<long double>, std::multiplies<long double>>,
+      FunctorT>;
+
+  std::mutex mutex;
+  accumulator_t total = sycl::known_identity_v<FunctorT, VariableT>;
+  long double magnitude = 0;
+  sycl_cts::util::get<sycl_cts::util::thread_pool>().parallel_for(
+      count, [&](size_t begin, size_t end) {
+        accumulator_t partial = sycl::known_identity_v<FunctorT, VariableT>;
+        long double partialMagnitude = 0;
+        for (size_t i = begin; i < end; ++i) {
+          const VariableT value = input(i);
+          partial = combine_t()(partial, value);
+          if constexpr (floating_sum) partialMagnitude += std::fabs(value);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        total = combine_t()(total, partial);
+        magnitude += partialMagnitude;
+      });
+  return {static_cast<VariableT>(total), static_cast<long double>(total),
+          magnitude};
+}
+
+/** @brief Checks the result of the reduction against the host reference
+ *
+ *  The sum and the product of the floating point types depend on the order of
+ *  the operations, which is unspecified. Their error is bounded by
+ *  gamma(n - 1) * magnitude, where n is the number of work-items and
+ *  gamma(k) = k * u / (1 - k * u) for the unit roundoff u, whatever the order
+ *  is. The bound is doubled to cover the rounding of the host reference where
+ *  long double is not wider than VariableT. The bound is only checked if it is
+ *  tight enough to detect a lost or duplicated work-item, i.e. if it is below
+ *  the average magnitude of an input for the sum and below the change of a
+ *  single factor for the product. Otherwise, which is the case of float for
+ *  more than a few thousand work-items, only the finiteness of the result is
+ *  checked and a warning tells the bound was skipped.
+ */
+template <typename VariableT, typename FunctorT>
+void check_result(VariableT result, const reference_result<VariableT>& ref,
+                  size_t count, const std::string& name) {
+  INFO(name << ": got " << result << ", expected "
+            << static_cast<double>(ref.value));
+  if constexpr (std::is_floating_point_v<VariableT> &&
+                (std::is_same_v<FunctorT, sycl::plus<VariableT>> ||
+                 std::is_same_v<FunctorT, sycl::multiplies<VariableT>>)) {
+    const long double u = std::numeric_limits<VariableT>::epsilon() / 2.0L;
+    const long double ku = static_cast<long double>(count - 1) * u;
+    constexpr bool is_sum = std::is_same_v<FunctorT, sycl::plus<VariableT>>;
+    CHECK(std::isfinite(result));
+    const long double detectable =
+        is_sum ? ref.magnitude / count : std::fabs(ref.value) / product_step;
+    const long double bound =
+        ku < 1 ? 2 * ku / (1 - ku) *
+                     (is_sum ? ref.magnitude : std::fabs(ref.value))
+               : std::numeric_limits<long double>::infinity();
+    if (bound < detectable) {
+      INFO("Error bound for " << count << " work-items: "
+                              << static_cast<double>(bound));
+      CHECK(std::fabs(static_cast<long double>(result) - ref.value) <= bound);
+    } else {
+      WARN(name << ": the error bound for " << count
+                << " work-items is too loose to be checked");
+    }
+  } else {
+    CHECK(result == ref.exact);
+  }
+}
+
+template <typename VariableT, typename FunctorT, int Variant>
+class large_scale_kernel;
+
+/** @brief Runs the reduction for the operator with sycl::range and with
+ *         sycl::nd_range of many work-groups, reporting the throughput
+ */
+template <typename VariableT, typename FunctorT>
+void run_test_for_functor(sycl::queue& queue, const std::string& type_name,
+                          const std::string& functor_name) {
+  const size_t workGroupSize = std::min(
+      max_work_group_size,
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>());
+  const size_t ndCount =
+      std::max<size_t>(1, get_size() / workGroupSize) * workGroupSize;
+  const size_t count = get_size();
+
+  const input_generator<VariableT, FunctorT> input(count);
+  const auto ndRef = get_reference(input, ndCount);
+  const auto ref = count == ndCount ? ndRef : get_reference(input, count);
+
+  VariableT result{};
+  const std::string name = type_name + ", " + functor_name;
+  {
+    sycl::buffer<VariableT, 1> resultBuf(&result, sycl::range<1>(1));
+    const auto seconds = sycl_cts::benchmark::time_warm_call([&] {
+      queue
+          .submit([&](sycl::handler& cgh) {
+            auto reduction = sycl::reduction(
+                resultBuf, cgh, FunctorT(),
+                {sycl::property::reduction::initialize_to_identity()});
+            cgh.parallel_for<large_scale_kernel<VariableT, FunctorT, 0>>(
+                sycl::range<1>(count), reduction,
+                [=](sycl::id<1> id, auto& reducer) {
+                  reducer.combine(input(id[0]));
+                });
+          })
+          .wait_and_throw();
+    });
+    sycl_cts::report_measurement(name + ", range", count / seconds.count(),
+                                 "work-items/s");
+  }
+  check_result<VariableT, FunctorT>(result, ref, count, name + ", range");
+
+  {
+    sycl::buffer<VariableT, 1> resultBuf(&result, sycl::range<1>(1));
+    const auto seconds = sycl_cts::benchmark::time_warm_call([&] {
+      queue
+          .submit([&](sycl::handler& cgh) {
+            auto reduction = sycl::reduction(
+                resultBuf, cgh, FunctorT(),
+                {sycl::property::reduction::initialize_to_identity()});
+            cgh.parallel_for<large_scale_kernel<VariableT, FunctorT, 1>>(
+                sycl::nd_range<1>(ndCount, workGroupSize), reduction,
+                [=](sycl::nd_item<1> item, auto& reducer) {
+                  reducer.combine(input(item.get_global_linear_id()));
+                });
+          })
+          .wait_and_throw();
+    });
+    sycl_cts::report_measurement(name + ", nd_range",
+                                 ndCount / seconds.count(), "work-items/s");
+  }
+  check_result<VariableT, FunctorT>(result, ndRef, ndCount,
+                                    name + ", nd_range");
+}
+
+template <typename VariableT>
+class several_reductions_kernel;
+
+/** @brief Runs the sum, the minimum and the maximum of the same work-items in
+ *         a single kernel
+ */
+template <typename VariableT>
+void run_test_for_several_reductions(sycl::queue& queue,
+                                     const std::string& type_name) {
+  using plus_t = sycl::plus<VariableT>;
+  using min_t = sycl::minimum<VariableT>;
+  using max_t = sycl::maximum<VariableT>;
+  const size_t count = get_size();
+  const input_generator<VariableT, plus_t> sumInput(count);
+  const input_generator<VariableT, min_t> minMaxInput(count);
+
+  VariableT results[3]{};
+  const std::string name = type_name + ", plus, minimum and maximum";
+  {
+    sycl::buffer<VariableT, 1> sumBuf(&results[0], sycl::range<1>(1));
+    sycl::buffer<VariableT, 1> minBuf(&results[1], sycl::range<1>(1));
+    sycl::buffer<VariableT, 1> maxBuf(&results[2], sycl::range<1>(1));
+    const auto seconds = sycl_cts::benchmark::time_warm_call([&] {
+      queue
+          .submit([&](sycl::handler& cgh) {
+            const sycl::property_list props{
+                sycl::property::reduction::initialize_to_identity()};
+            cgh.parallel_for<several_reductions_kernel<VariableT>>(
+                sycl::range<1>(count),
+                sycl::reduction(sumBuf, cgh, plus_t(), props),
+                sycl::reduction(minBuf, cgh, min_t(), props),
+                sycl::reduction(maxBuf, cgh, max_t(), props),
+                [=](sycl::id<1> id, auto& sum, auto& lowest, auto& highest) {
+                  sum.combine(sumInput(id[0]));
+                  const VariableT value = minMaxInput(id[0]);
+                  lowest.combine(value);
+                  highest.combine(value);
+                });
+          })
+          .wait_and_throw();
+    });
+    sycl_cts::report_measurement(name, count / seconds.count(),
+                                 "work-items/s");
+  }
+  check_result<VariableT, plus_t>(results[0], get_reference(sumInput, count),
+                                  count, name + ": plus");
+  check_result<VariableT, min_t>(results[1], get_reference(minMaxInput, count),
+                                 count, name + ": minimum");
+  const input_generator<VariableT, max_t> maxInput(count);
+  check_result<VariableT, max_t>(results[2], get_reference(maxInput, count),
+                                 count, name + ": maximum");
+}
+
+/** @brief Runs the large-scale reductions of the type for the operators of
+ *         the existing reduction tests
+ *  @tparam VariableT Variable type from type coverage
+ */
+template <typename VariableT>
+struct run_large_scale_tests_for_all_functors {
+  void operator()(sycl::queue& queue, const std::string& type_name) {
+    run_test_for_functor<VariableT, sycl::plus<VariableT>>(queue, type_name,
+                                                           "plus");
+    run_test_for_functor<VariableT, sycl::multiplies<VariableT>>(
+        queue, type_name, "multiplies");
+    if constexpr (std::is_integral_v<VariableT>) {
+      run_test_for_functor<VariableT, sycl::bit_and<VariableT>>(
+          queue, type_name, "bit_and");
+      run_test_for_functor<VariableT, sycl::bit_or<VariableT>>(
+          queue, type_name, "bit_or");
+      run_test_for_functor<VariableT, sycl::bit_xor<VariableT>>(
+          queue, type_name, "bit_xor");
+    }
+    run_test_for_functor<VariableT, sycl::minimum<VariableT>>(
+        queue, type_name, "minimum");
+    run_test_for_functor<VariableT, sycl::maximum<VariableT>>(
+        queue, type_name, "maximum");
+    run_test_for_several_reductions<VariableT>(queue, type_name);
+  }
+};
+
+}  // namespace reduction_large_scale
+
+#endif  // __SYCL_CTS_TEST_REDUCTION_LARGE_SCALE_H
@@ -0,0 +1,45 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides sycl::reduction tests over many work-groups for the scalar types
+//
+*******************************************************************************/
+
+#include "../common/disabled_for_test_case.h"
+#include "catch2/catch_test_macros.hpp"
+
+// FIXME: re-enable when sycl::reduction is implemented in hipSYCL
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+#include "reduction_common.h"
+#include "reduction_large_scale.h"
+#endif
+
+namespace reduction_large_scale_core {
+
+// The large-scale run is hidden from the default run, it can be selected by
+// the [large_scale] tag.
+// FIXME: re-enable when sycl::reduction is implemented in hipSYCL
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("reduction over many work-groups", "[reduction][.large_scale]")({
+  auto queue = sycl_cts::util::get_cts_object::queue();
+
+  for_all_types<reduction_large_scale::run_large_scale_tests_for_all_functors>(
+      reduction_common::scalar_types, queue);
+});
+
+}  // namespace reduction_large_scale_core
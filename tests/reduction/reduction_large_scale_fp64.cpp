@@ -0,0 +1,48 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides sycl::reduction tests over many work-groups for double
+//
+*******************************************************************************/
+
+#include "../../util/extensions.h"
+#include "../common/disabled_for_test_case.h"
+#include "catch2/catch_test_macros.hpp"
+
+// FIXME: re-enable when sycl::reduction is implemented in hipSYCL
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+#include "reduction_large_scale.h"
+#endif
+
+namespace reduction_large_scale_fp64 {
+
+// FIXME: re-enable when sycl::reduction is implemented in hipSYCL
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("reduction over many work-groups fp64", "[reduction][fp64][.large_scale]")({
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  using avaliability = sycl_cts::util::extensions::availability<
+      sycl_cts::util::extensions::tag::fp64>;
+  if (!avaliability::check(queue)) {
+    SKIP("Device does not support double precision floating point operations.");
+  }
+
+  reduction_large_scale::run_large_scale_tests_for_all_functors<double>{}(
+      queue, "double");
+});
+
+}  // namespace reduction_large_scale_fp64
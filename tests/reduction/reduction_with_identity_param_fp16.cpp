@@ -33,8 +33,10 @@ namespace reduction_with_identity_param_fp16 {
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_fp16", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -46,8 +48,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_item_twice_fp16", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -59,8 +63,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_even_item_fp16", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -72,8 +78,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_no_one_item_fp16", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
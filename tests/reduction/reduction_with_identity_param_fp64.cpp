@@ -33,8 +33,10 @@ namespace reduction_with_identity_param_fp64 {
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_fp64", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
   reduction_with_identity_param::run_test_for_type<double>()(queue, "double");
@@ -44,8 +46,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_item_twice_fp64", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
   reduction_with_identity_param::run_test_for_type_item_twice<double>()(
@@ -56,8 +60,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_even_item_fp64", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
   reduction_with_identity_param::run_test_for_type_even_item<double>()(
@@ -68,8 +74,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
 DISABLED_FOR_TEST_CASE(hipSYCL)
 ("reduction_with_identity_param_no_one_fp64", "[reduction]")({
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
   reduction_with_identity_param::run_test_for_type_no_one_item<double>()(
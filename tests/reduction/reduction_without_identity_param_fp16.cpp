@@ -36,8 +36,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -57,8 +59,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -80,8 +84,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
@@ -101,8 +107,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp16)) {
+  if (!capabilities.has(sycl::aspect::fp16)) {
     SKIP("Device does not support half precision floating point operations");
   }
 
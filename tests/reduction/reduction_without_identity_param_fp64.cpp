@@ -37,8 +37,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
 
@@ -59,8 +61,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
 
@@ -81,8 +85,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
 
@@ -103,8 +109,10 @@ DISABLED_FOR_TEST_CASE(hipSYCL)
   using namespace reduction_without_identity_param_common;
 
   auto queue = sycl_cts::util::get_cts_object::queue();
+  const auto& capabilities =
+      sycl_cts::util::get<sycl_cts::util::device_manager>().get_capabilities();
 
-  if (!queue.get_device().has(sycl::aspect::fp64)) {
+  if (!capabilities.has(sycl::aspect::fp64)) {
     SKIP("Device does not support double precision floating point operations");
   }
 
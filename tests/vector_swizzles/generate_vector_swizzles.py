@@ -40,6 +40,11 @@ def main():
         required=True,
         choices=get_types(),
         help='Type to generate the test for')
+    argparser.add_argument(
+        '-fused',
+        choices=['true', 'false'],
+        default='false',
+        help='Check all the swizzles of a vector size by a single kernel')
     argparser.add_argument(
         '-o',
         required=True,
@@ -48,7 +53,8 @@ def main():
         help='CTS test output')
     args = argparser.parse_args()
 
-    make_swizzles_tests(args.ty, args.template, args.output)
+    make_swizzles_tests(args.ty, args.template, args.output,
+                        args.fused == 'true')
 
 
 if __name__ == '__main__':
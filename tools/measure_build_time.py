@@ -1,43 +1,325 @@
 #!/usr/bin/env python3
 
 """
-Utility script for measuring the build time of a translation unit.
-Not intended for manual use.
+Utility script for measuring the build cost of a translation unit.
 To enable, specify SYCL_CTS_MEASURE_BUILD_TIMES=ON during CMake configuration.
+
+When used as a compiler launcher, appends the wall time of each compilation to
+'build_times.log' and the wall time, CPU time and peak memory usage to
+'build_profile.jsonl' in the build directory. With --time-trace the compiler is
+also asked for a -ftime-trace profile of the translation unit.
+
+Run with '--summary [<build directory>]' to print the cost of the test
+categories and, if time traces were collected, the most expensive headers and
+template instantiations.
 """
 
+import argparse
+import json
 import os
+import re
 import subprocess
 import sys
 
+from collections import defaultdict
 from pathlib import Path
 from timeit import default_timer as timer
 
-args = sys.argv[1:]
-
-# We assume arguments to end with '-o <object file> -c <source file>'
-# FIXME: This may not work with MSVC
-obj_file = os.path.basename(args[-3])
-src_file = args[-1]
-
-# Locate build root: The compiler may not always be launched directly from
-# within the main build directory. We want to write all results into the
-# same file within the build directory, so we have to locate it first.
-# Walk parents until we find 'CMakeCache.txt'.
-build_root = Path(os.getcwd())
-for p in [build_root] + list(build_root.parents):
-    if os.path.isfile(p / 'CMakeCache.txt'):
-        build_root = p
-        break
-
-# Make source file path relative to build directory
-src_file = os.path.relpath(src_file, build_root)
-
-ts_before = timer()
-subprocess.run(' '.join(args), shell=True)
-ts_after = timer()
-dt = ts_after - ts_before
-
-with open(build_root / "build_times.log", "a") as output_file:
-    print(f"{dt:.1f} {obj_file} ({src_file})",
-          file=output_file)
+try:
+    import resource
+except ImportError:
+    # Not available on Windows, only the wall time is measured there
+    resource = None
+
+PROFILE_FILE = 'build_profile.jsonl'
+
+# Trace events describing the parsing of a header and template instantiations
+TRACE_SOURCE_EVENT = 'Source'
+TRACE_INSTANTIATION_EVENTS = ('InstantiateFunction', 'InstantiateClass')
+
+
+def find_build_root():
+    """
+    The compiler may not always be launched directly from within the main
+    build directory. We want to write all results into the same file within
+    the build directory, so we have to locate it first.
+    Walk parents until we find 'CMakeCache.txt'.
+    """
+    build_root = Path(os.getcwd())
+    for p in [build_root] + list(build_root.parents):
+        if os.path.isfile(p / 'CMakeCache.txt'):
+            return p
+    return build_root
+
+
+def get_children_usage():
+    """
+    Returns the CPU seconds and the peak resident memory in KiB of the
+    terminated child processes.
+    """
+    if resource is None:
+        return None, None
+    usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    max_rss = usage.ru_maxrss
+    if sys.platform == 'darwin':
+        # Reported in bytes instead of KiB
+        max_rss //= 1024
+    return usage.ru_utime + usage.ru_stime, max_rss
+
+
+def get_category(src_file):
+    """
+    Returns the test category of the source file, or the name of the top
+    level directory for the sources out of the tests directory.
+    """
+    parts = Path(src_file).parts
+    if 'tests' in parts:
+        index = len(parts) - 1 - parts[::-1].index('tests')
+        if index + 2 < len(parts):
+            return parts[index + 1]
+    parts = [part for part in parts if part not in ('.', '..')]
+    return parts[0] if len(parts) > 1 else 'other'
+
+
+def launch(args, time_trace):
+    """
+    Runs the compiler command, records its cost and returns its exit code.
+    """
+    # We assume arguments to contain '-o <object file>' and to end with
+    # '-c <source file>'
+    # FIXME: This may not work with MSVC
+    obj_path = args[args.index('-o') + 1] if '-o' in args else args[-3]
+    obj_file = os.path.basename(obj_path)
+    src_file = args[-1]
+
+    build_root = find_build_root()
+
+    # Make source file path relative to build directory
+    src_file = os.path.relpath(src_file, build_root)
+
+    if time_trace:
+        # Other launchers like ccache may precede the compiler, so pass the
+        # flag right before '-c' where it only reaches the compiler
+        position = (len(args) - 1 - args[::-1].index('-c')
+                    if '-c' in args else len(args) - 1)
+        args = args[:position] + ['-ftime-trace'] + args[position:]
+
+    ts_before = timer()
+    result = subprocess.run(' '.join(args), shell=True)
+    ts_after = timer()
+    dt = ts_after - ts_before
+
+    # Each compilation runs in its own launcher process, so the usage of the
+    # children is the usage of this compilation
+    cpu, max_rss = get_children_usage()
+
+    # Clang writes the trace next to the object file
+    trace = None
+    if time_trace:
+        trace_path = os.path.splitext(obj_path)[0] + '.json'
+        if os.path.isfile(trace_path):
+            trace = os.path.relpath(os.path.abspath(trace_path), build_root)
+
+    with open(build_root / "build_times.log", "a") as output_file:
+        print(f"{dt:.1f} {obj_file} ({src_file})",
+              file=output_file)
+
+    record = {
+        'object': obj_file,
+        'source': src_file,
+        'category': get_category(src_file),
+        'wall': round(dt, 2),
+        'cpu': round(cpu, 2) if cpu is not None else None,
+        'max_rss_kib': max_rss,
+        'trace': trace,
+        'exit_code': result.returncode
+    }
+    # A single write keeps the lines of the parallel compilations intact
+    with open(build_root / PROFILE_FILE, "a") as output_file:
+        output_file.write(json.dumps(record) + '\n')
+
+    return result.returncode
+
+
+def load_profile(build_root):
+    """
+    Returns the latest record of each object file in the build profile.
+    """
+    records = {}
+    with open(os.path.join(build_root, PROFILE_FILE), 'r') as profile:
+        for line in profile:
+            if line.strip():
+                record = json.loads(line)
+                records[record['source']] = record
+    return list(records.values())
+
+
+def strip_template_arguments(name):
+    """
+    Returns the name of the template instantiation without its arguments to
+    aggregate all instantiations of the same template.
+    """
+    stripped = None
+    while stripped != name:
+        # Remove the innermost argument lists first
+        stripped, name = name, re.sub(r'<[^<>]*>', '', name)
+    return name
+
+
+def add_outermost_time(entry, intervals):
+    """
+    Adds the time of the intervals to the entry, counting the time of the
+    events nested into an event with the same name, like the recursive
+    instantiations of a template, only once.
+    """
+    end = None
+    for begin, duration in sorted(intervals):
+        if end is None or begin >= end:
+            entry[0] += duration / 1e6
+            end = begin + duration
+        elif begin + duration > end:
+            # Overlapping without nesting, count the exceeding part only
+            entry[0] += (begin + duration - end) / 1e6
+            end = begin + duration
+        entry[1] += 1
+
+
+def aggregate_traces(build_root, records):
+    """
+    Returns the total inclusive time in seconds and the number of occurrences
+    per header and per instantiated template over all time traces. Only the
+    outermost of nested events with the same name contributes its time.
+    """
+    headers = defaultdict(lambda: [0.0, 0])
+    templates = defaultdict(lambda: [0.0, 0])
+    for record in records:
+        if not record.get('trace'):
+            continue
+        trace_path = os.path.join(build_root, record['trace'])
+        if not os.path.isfile(trace_path):
+            continue
+        with open(trace_path, 'r') as trace_file:
+            try:
+                events = json.load(trace_file)['traceEvents']
+            except (ValueError, KeyError):
+                continue
+        intervals = defaultdict(list)
+        for event in events:
+            detail = event.get('args', {}).get('detail')
+            if not detail or 'dur' not in event or 'ts' not in event:
+                continue
+            if event['name'] == TRACE_SOURCE_EVENT:
+                table, name = headers, detail
+            elif event['name'] in TRACE_INSTANTIATION_EVENTS:
+                table, name = templates, strip_template_arguments(detail)
+            else:
+                continue
+            # Events of the same name only nest within the same thread
+            intervals[(table is headers, name, event.get('tid'))].append(
+                (event['ts'], event['dur']))
+        for (is_header, name, _), name_intervals in intervals.items():
+            table = headers if is_header else templates
+            add_outermost_time(table[name], name_intervals)
+    return headers, templates
+
+
+def print_table(title, header, rows):
+    print(title)
+    widths = [
+        max(len(str(row[i])) for row in [header] + rows)
+        for i in range(len(header))
+    ]
+    for row in [header] + rows:
+        print('  ' + '  '.join(
+            str(value).rjust(widths[i]) if i else str(value).ljust(widths[i])
+            for i, value in enumerate(row)))
+    print()
+
+
+def summary(build_root, count, memory_gib):
+    """
+    Prints the cost of the test categories ranked by CPU time, the largest
+    compilations, and the most expensive headers and templates if traced.
+    """
+    records = load_profile(build_root)
+    if not records:
+        print("No compilations recorded in " + PROFILE_FILE)
+        return 1
+
+    categories = defaultdict(lambda: {'count': 0, 'wall': 0.0, 'cpu': 0.0,
+                                      'rss': 0})
+    for record in records:
+        category = categories[record['category']]
+        category['count'] += 1
+        category['wall'] += record['wall']
+        category['cpu'] += record['cpu'] or record['wall']
+        category['rss'] = max(category['rss'], record['max_rss_kib'] or 0)
+
+    ranked = sorted(categories.items(), key=lambda c: c[1]['cpu'],
+                    reverse=True)
+    print_table('Test categories by CPU time:',
+                ('Category', 'TUs', 'CPU s', 'Wall s', 'Peak RSS MiB'),
+                [(name, c['count'], '%.1f' % c['cpu'], '%.1f' % c['wall'],
+                  c['rss'] // 1024) for name, c in ranked])
+
+    largest = sorted(records, key=lambda r: r['max_rss_kib'] or 0,
+                     reverse=True)[:count]
+    print_table('Translation units by peak memory:',
+                ('Source', 'Peak RSS MiB', 'CPU s'),
+                [(r['source'], (r['max_rss_kib'] or 0) // 1024,
+                  '%.1f' % (r['cpu'] or r['wall'])) for r in largest])
+
+    peak_rss_gib = max(r['max_rss_kib'] or 0 for r in records) / 1024**2
+    if memory_gib is None and hasattr(os, 'sysconf'):
+        try:
+            memory_gib = (os.sysconf('SC_PAGE_SIZE') *
+                          os.sysconf('SC_PHYS_PAGES') / 1024**3)
+        except (ValueError, OSError):
+            pass
+    if peak_rss_gib > 0 and memory_gib:
+        print('Largest compilation uses %.2f GiB, at most %d parallel jobs '
+              'fit into %.1f GiB in the worst case\n' %
+              (peak_rss_gib, max(1, int(memory_gib // peak_rss_gib)),
+               memory_gib))
+
+    headers, templates = aggregate_traces(build_root, records)
+    if headers:
+        print_table('Headers by inclusive parsing time:',
+                    ('Header', 'Total s', 'Includes'),
+                    [(name, '%.1f' % cost[0], cost[1]) for name, cost in
+                     sorted(headers.items(), key=lambda h: h[1][0],
+                            reverse=True)[:count]])
+    if templates:
+        print_table('Templates by inclusive instantiation time:',
+                    ('Template', 'Total s', 'Instantiations'),
+                    [(name, '%.1f' % cost[0], cost[1]) for name, cost in
+                     sorted(templates.items(), key=lambda t: t[1][0],
+                            reverse=True)[:count]])
+    return 0
+
+
+def main(argv):
+    if argv and argv[0] == '--summary':
+        parser = argparse.ArgumentParser(
+            prog='measure_build_time.py --summary',
+            description='Summarize the build cost recorded in ' +
+            PROFILE_FILE)
+        parser.add_argument('build_dir', nargs='?', default='.',
+                            help='Build directory, current one by default')
+        parser.add_argument('-n', '--count', type=int, default=20,
+                            help='Number of entries in the top lists')
+        parser.add_argument('--memory', type=float,
+                            help='Memory of the builder in GiB used to '
+                            'suggest the number of parallel jobs, the memory '
+                            'of this machine by default')
+        args = parser.parse_args(argv[1:])
+        return summary(args.build_dir, args.count, args.memory)
+
+    time_trace = bool(argv) and argv[0] == '--time-trace'
+    if time_trace:
+        argv = argv[1:]
+    return launch(argv, time_trace)
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -8,40 +8,46 @@
 
 #include "aspect_set.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace sycl_cts::util::aspect {
 
 namespace detail {
 
+// Aspects known to the CTS, the position in the list is the bit of the aspect
+// within aspect_mask
+#define ASPECT_SET_IMPL_FOR_EACH(action) \
+  action(cpu);                           \
+  action(gpu);                           \
+  action(accelerator);                   \
+  action(custom);                        \
+  /* action(emulated); */                \
+  /* action(host_debuggable); */         \
+  action(fp16);                          \
+  action(fp64);                          \
+  action(atomic64);                      \
+  action(image);                         \
+  action(online_compiler);               \
+  action(online_linker);                 \
+  action(queue_profiling);               \
+  action(usm_device_allocations);        \
+  action(usm_host_allocations);          \
+  action(usm_atomic_host_allocations);   \
+  action(usm_shared_allocations);        \
+  action(usm_atomic_shared_allocations); \
+  action(usm_system_allocations)
+
 #define ASPECT_SET_IMPL_MAP_NAME(aspectName) \
   case sycl::aspect::aspectName:             \
-    result = TOSTRING(aspectName);           \
+    result = #aspectName;                    \
     break
 
 inline std::string map_name(sycl::aspect value) {
   std::string result{"n/a"};
 
   switch (value) {
-    ASPECT_SET_IMPL_MAP_NAME(cpu);
-    ASPECT_SET_IMPL_MAP_NAME(gpu);
-    ASPECT_SET_IMPL_MAP_NAME(accelerator);
-    ASPECT_SET_IMPL_MAP_NAME(custom);
-    // ASPECT_SET_IMPL_MAP_NAME(emulated);
-    // ASPECT_SET_IMPL_MAP_NAME(host_debuggable);
-    ASPECT_SET_IMPL_MAP_NAME(fp16);
-    ASPECT_SET_IMPL_MAP_NAME(fp64);
-    ASPECT_SET_IMPL_MAP_NAME(atomic64);
-    ASPECT_SET_IMPL_MAP_NAME(image);
-    ASPECT_SET_IMPL_MAP_NAME(online_compiler);
-    ASPECT_SET_IMPL_MAP_NAME(online_linker);
-    ASPECT_SET_IMPL_MAP_NAME(queue_profiling);
-    ASPECT_SET_IMPL_MAP_NAME(usm_device_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_host_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_atomic_host_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_shared_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_atomic_shared_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_system_allocations);
+    ASPECT_SET_IMPL_FOR_EACH(ASPECT_SET_IMPL_MAP_NAME);
     default:
       throw std::logic_error("Failed to map_name");
   }
@@ -50,6 +56,18 @@ inline std::string map_name(sycl::aspect value) {
 
 #undef ASPECT_SET_IMPL_MAP_NAME
 
+#define ASPECT_SET_IMPL_ADD(aspectName) \
+  result.push_back(sycl::aspect::aspectName)
+
+inline std::vector<sycl::aspect> make_all() {
+  std::vector<sycl::aspect> result;
+  ASPECT_SET_IMPL_FOR_EACH(ASPECT_SET_IMPL_ADD);
+  return result;
+}
+
+#undef ASPECT_SET_IMPL_ADD
+#undef ASPECT_SET_IMPL_FOR_EACH
+
 }  // namespace detail
 
 std::string to_string(sycl::aspect asp) { return detail::map_name(asp); }
@@ -70,4 +88,38 @@ std::string to_string(const aspect_set &asp_set) {
   return result;
 }
 
+const std::vector<sycl::aspect> &get_all() {
+  static const std::vector<sycl::aspect> all = detail::make_all();
+  return all;
+}
+
+bool is_known(sycl::aspect asp) {
+  const auto &all = get_all();
+  return std::find(all.begin(), all.end(), asp) != all.end();
+}
+
+aspect_mask to_mask(sycl::aspect asp) {
+  const auto &all = get_all();
+  const auto it = std::find(all.begin(), all.end(), asp);
+  if (it == all.end()) throw std::logic_error("Failed to map aspect to mask");
+  return aspect_mask{1} << (it - all.begin());
+}
+
+aspect_mask to_mask(const aspect_set &asp_set) {
+  aspect_mask result = 0;
+  for (const auto &asp : asp_set) {
+    result |= to_mask(asp);
+  }
+  return result;
+}
+
+aspect_set from_mask(aspect_mask mask) {
+  aspect_set result;
+  const auto &all = get_all();
+  for (std::size_t i = 0; i < all.size(); ++i) {
+    if (mask & (aspect_mask{1} << i)) result.insert(all[i]);
+  }
+  return result;
+}
+
 }  // namespace sycl_cts::util::aspect
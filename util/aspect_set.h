@@ -9,10 +9,12 @@
 #ifndef __SYCLCTS_UTIL_ASPECT_SET_H
 #define __SYCLCTS_UTIL_ASPECT_SET_H
 
-#include "../tests/common/common.h"
+#include <sycl/sycl.hpp>
 
+#include <cstdint>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace sycl_cts::util::aspect {
 
@@ -46,6 +48,33 @@ std::string to_string(sycl::aspect asp);
  */
 std::string to_string(const aspect_set &asp_set);
 
+/** @brief Provides compact set of aspects with one bit per aspect known to the
+ *         CTS, in the order of get_all()
+ */
+using aspect_mask = std::uint64_t;
+
+/** @brief Provides all aspects known to the CTS
+ */
+const std::vector<sycl::aspect> &get_all();
+
+/** @brief Checks whether the aspect is one of get_all(), so it has a bit
+ *         within util::aspect::aspect_mask
+ */
+bool is_known(sycl::aspect asp);
+
+/** @brief Provides the bit of the aspect within util::aspect::aspect_mask
+ *  @throws std::logic_error if the aspect is not known to the CTS
+ */
+aspect_mask to_mask(sycl::aspect asp);
+
+/** @brief Converts util::aspect::aspect_set to util::aspect::aspect_mask
+ */
+aspect_mask to_mask(const aspect_set &asp_set);
+
+/** @brief Converts util::aspect::aspect_mask to util::aspect::aspect_set
+ */
+aspect_set from_mask(aspect_mask mask);
+
 }  // namespace sycl_cts::util::aspect
 
 #endif  // __SYCLCTS_UTIL_ASPECT_SET_H
@@ -0,0 +1,165 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "device_capabilities.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace sycl_cts {
+namespace util {
+
+static const char* get_memory_order_str(sycl::memory_order order) {
+  switch (order) {
+    case sycl::memory_order::relaxed:
+      return "relaxed";
+    case sycl::memory_order::acquire:
+      return "acquire";
+    case sycl::memory_order::release:
+      return "release";
+    case sycl::memory_order::acq_rel:
+      return "acq_rel";
+    case sycl::memory_order::seq_cst:
+      return "seq_cst";
+    default:
+      return "(unknown)";
+  }
+}
+
+static const char* get_memory_scope_str(sycl::memory_scope scope) {
+  switch (scope) {
+    case sycl::memory_scope::work_item:
+      return "work_item";
+    case sycl::memory_scope::sub_group:
+      return "sub_group";
+    case sycl::memory_scope::work_group:
+      return "work_group";
+    case sycl::memory_scope::device:
+      return "device";
+    case sycl::memory_scope::system:
+      return "system";
+    default:
+      return "(unknown)";
+  }
+}
+
+template <typename T, typename ToStringT>
+static void write_json_array(std::ostream& out, const std::vector<T>& values,
+                             ToStringT to_string) {
+  out << '[';
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    out << (i > 0 ? ", " : "") << to_string(values[i]);
+  }
+  out << ']';
+}
+
+device_capabilities device_capabilities::query(const sycl::device& device) {
+  device_capabilities result;
+  result.device = device;
+  for (const auto asp : aspect::get_all()) {
+    if (device.has(asp)) result.aspects |= aspect::to_mask(asp);
+  }
+
+  result.max_compute_units =
+      device.get_info<sycl::info::device::max_compute_units>();
+  result.max_work_group_size =
+      device.get_info<sycl::info::device::max_work_group_size>();
+  const auto max_work_item_sizes =
+      device.get_info<sycl::info::device::max_work_item_sizes<3>>();
+  for (int dim = 0; dim < 3; ++dim) {
+    result.max_work_item_sizes[dim] = max_work_item_sizes[dim];
+  }
+  result.max_num_sub_groups =
+      device.get_info<sycl::info::device::max_num_sub_groups>();
+  result.sub_group_sizes =
+      device.get_info<sycl::info::device::sub_group_sizes>();
+
+  result.local_mem_size =
+      device.get_info<sycl::info::device::local_mem_size>();
+  result.global_mem_size =
+      device.get_info<sycl::info::device::global_mem_size>();
+  result.max_mem_alloc_size =
+      device.get_info<sycl::info::device::max_mem_alloc_size>();
+  result.mem_base_addr_align =
+      device.get_info<sycl::info::device::mem_base_addr_align>();
+
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+  result.atomic_memory_orders =
+      device.get_info<sycl::info::device::atomic_memory_order_capabilities>();
+  result.atomic_memory_scopes =
+      device.get_info<sycl::info::device::atomic_memory_scope_capabilities>();
+#endif
+  return result;
+}
+
+bool device_capabilities::has_sub_group_size(std::size_t size) const {
+  return std::find(sub_group_sizes.begin(), sub_group_sizes.end(), size) !=
+         sub_group_sizes.end();
+}
+
+bool device_capabilities::supports(sycl::memory_order order) const {
+  return std::find(atomic_memory_orders.begin(), atomic_memory_orders.end(),
+                   order) != atomic_memory_orders.end();
+}
+
+bool device_capabilities::supports(sycl::memory_scope scope) const {
+  return std::find(atomic_memory_scopes.begin(), atomic_memory_scopes.end(),
+                   scope) != atomic_memory_scopes.end();
+}
+
+std::string device_capabilities::to_json() const {
+  const auto quote = [](const std::string& value) {
+    return '"' + value + '"';
+  };
+  const auto aspect_list = aspect::from_mask(aspects);
+
+  std::ostringstream out;
+  out << "{\"aspects\": ";
+  write_json_array(
+      out, std::vector<sycl::aspect>(aspect_list.begin(), aspect_list.end()),
+      [&](sycl::aspect asp) { return quote(aspect::to_string(asp)); });
+  out << ", \"max-compute-units\": " << max_compute_units
+      << ", \"max-work-group-size\": " << max_work_group_size
+      << ", \"max-work-item-sizes\": ";
+  write_json_array(out,
+                   std::vector<std::size_t>(max_work_item_sizes.begin(),
+                                            max_work_item_sizes.end()),
+                   [](std::size_t size) { return size; });
+  out << ", \"max-num-sub-groups\": " << max_num_sub_groups
+      << ", \"sub-group-sizes\": ";
+  write_json_array(out, sub_group_sizes, [](std::size_t size) { return size; });
+  out << ", \"local-mem-size\": " << local_mem_size
+      << ", \"global-mem-size\": " << global_mem_size
+      << ", \"max-mem-alloc-size\": " << max_mem_alloc_size
+      << ", \"mem-base-addr-align\": " << mem_base_addr_align
+      << ", \"atomic-memory-orders\": ";
+  write_json_array(out, atomic_memory_orders, [&](sycl::memory_order order) {
+    return quote(get_memory_order_str(order));
+  });
+  out << ", \"atomic-memory-scopes\": ";
+  write_json_array(out, atomic_memory_scopes, [&](sycl::memory_scope scope) {
+    return quote(get_memory_scope_str(scope));
+  });
+  out << '}';
+  return out.str();
+}
+
+}  // namespace util
+}  // namespace sycl_cts
@@ -0,0 +1,101 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
+#define __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
+
+#include <sycl/sycl.hpp>
+
+#include "aspect_set.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Snapshot of the aspects and limits of a device. The snapshot of each device
+ * is queried once per process by device_manager::get_capabilities(), so the
+ * checks repeated for every tested combination do not query the device again.
+ */
+struct device_capabilities {
+  aspect::aspect_mask aspects = 0;
+
+  // Queried for the aspects not known to the CTS, e.g. the ones the
+  // implementations may not define yet
+  std::optional<sycl::device> device;
+
+  std::size_t max_compute_units = 0;
+  std::size_t max_work_group_size = 0;
+  std::array<std::size_t, 3> max_work_item_sizes{};
+  std::size_t max_num_sub_groups = 0;
+  std::vector<std::size_t> sub_group_sizes;
+
+  std::uint64_t local_mem_size = 0;
+  std::uint64_t global_mem_size = 0;
+  std::uint64_t max_mem_alloc_size = 0;
+  std::uint32_t mem_base_addr_align = 0;
+
+  // Not queried with hipSYCL, which does not implement these descriptors
+  std::vector<sycl::memory_order> atomic_memory_orders;
+  std::vector<sycl::memory_scope> atomic_memory_scopes;
+
+  /**
+   * @return The capabilities of the device, queried from the SYCL runtime
+   */
+  static device_capabilities query(const sycl::device& device);
+
+  bool has(sycl::aspect asp) const {
+    if (!aspect::is_known(asp)) return device && device->has(asp);
+    return (aspects & aspect::to_mask(asp)) != 0;
+  }
+
+  /**
+   * @return The aspects of the given set the device does not have
+   */
+  aspect::aspect_set get_missing(const aspect::aspect_set& required) const {
+    aspect::aspect_set missing;
+    for (const auto asp : required) {
+      if (!has(asp)) missing.insert(asp);
+    }
+    return missing;
+  }
+
+  bool has_sub_group_size(std::size_t size) const;
+
+  bool supports(sycl::memory_order order) const;
+
+  bool supports(sycl::memory_scope scope) const;
+
+  /**
+   * @return The snapshot as a JSON object, with the aspects listed by name
+   */
+  std::string to_json() const;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
@@ -23,7 +23,7 @@
 
 #include <fstream>
 
-#include "../tests/common/cts_selector.h"
+#include "../tests/common/cts_async_handler.h"
 
 namespace sycl_cts {
 namespace util {
@@ -51,9 +51,49 @@ static std::string get_device_type_str(const sycl::device& d) {
   };
 }
 
-void device_manager::list_devices() const {
+int device_manager::rate_device(const sycl::device& dev) const {
+  if (!device_regex.has_value()) {
+    return sycl::default_selector_v(dev);
+  }
+
+  const auto platform_name =
+      dev.get_platform().get_info<sycl::info::platform::name>();
+  const auto device_name = dev.get_info<sycl::info::device::name>();
+
+  if (std::regex_search(platform_name + " / " + device_name, *device_regex)) {
+    return 1000;
+  }
+
+  return -1;
+}
+
+const device_manager::resolved_device& device_manager::resolve() {
+  std::lock_guard<std::mutex> lock(resolve_mutex);
+  if (!resolved.has_value()) {
+    // Throws if no device matches, in which case the next call retries
+    const sycl::device device(
+        [this](const sycl::device& dev) { return rate_device(dev); });
+    const auto platform = device.get_platform();
+    resolved = resolved_device{device, platform,
+                               sycl::context(device, cts_async_handler{}),
+                               sycl::device::get_devices().size()};
+  }
+  return *resolved;
+}
+
+const device_capabilities& device_manager::get_capabilities(
+    const sycl::device& dev) {
+  std::lock_guard<std::mutex> lock(capabilities_mutex);
+  auto it = capabilities.find(dev);
+  if (it == capabilities.end()) {
+    it = capabilities.emplace(dev, device_capabilities::query(dev)).first;
+  }
+  return it->second;
+}
+
+void device_manager::list_devices() {
   const auto all_devices = sycl::device::get_devices();
-  const auto cts_device = sycl::device(cts_selector);
+  const auto cts_device = get_device();
 
   if (all_devices.empty()) {
     printf("No devices available.\n");
@@ -75,8 +115,8 @@ void device_manager::list_devices() const {
 }
 
 void device_manager::dump_info(const std::string& infoDumpFile) {
-  auto chosenDevice = sycl::device(cts_selector);
-  auto chosenPlatform = sycl::platform(cts_selector);
+  auto chosenDevice = get_device();
+  auto chosenPlatform = get_platform();
 
   std::fstream infoFile(infoDumpFile, std::ios::out);
 
@@ -108,12 +148,16 @@ void device_manager::dump_info(const std::string& infoDumpFile) {
       deviceTypeStr = "device_type::all";
       break;
   };
-  auto doesDeviceSupportHalf =
-      chosenDevice.has(sycl::aspect::fp16) ? "Supported" : "Not Supported";
-  auto doesDeviceSupportDouble =
-      chosenDevice.has(sycl::aspect::fp64) ? "Supported" : "Not Supported";
+  const auto& deviceCapabilities = get_capabilities(chosenDevice);
+  auto doesDeviceSupportHalf = deviceCapabilities.has(sycl::aspect::fp16)
+                                   ? "Supported"
+                                   : "Not Supported";
+  auto doesDeviceSupportDouble = deviceCapabilities.has(sycl::aspect::fp64)
+                                     ? "Supported"
+                                     : "Not Supported";
   auto doesDeviceSupportAtomics =
-      chosenDevice.has(sycl::aspect::atomic64) ? "Supported" : "Not Supported";
+      deviceCapabilities.has(sycl::aspect::atomic64) ? "Supported"
+                                                     : "Not Supported";
   auto platformNameStr = chosenPlatform.get_info<sycl::info::platform::name>();
   auto platformVendorStr =
       chosenPlatform.get_info<sycl::info::platform::vendor>();
@@ -129,7 +173,9 @@ void device_manager::dump_info(const std::string& infoDumpFile) {
            << "\", \"device-atomic64\": \"" << doesDeviceSupportAtomics
            << "\", \"platform-name\": \"" << platformNameStr
            << "\", \"platform-vendor\": \"" << platformVendorStr
-           << "\", \"platform-version\": \"" << platformVersionStr << "\"}";
+           << "\", \"platform-version\": \"" << platformVersionStr
+           << "\", \"capabilities\": " << deviceCapabilities.to_json()
+           << "}";
 }
 
 }  // namespace util
@@ -22,17 +22,28 @@
 #ifndef __SYCLCTS_UTIL_TEST_MANAGER_H
 #define __SYCLCTS_UTIL_TEST_MANAGER_H
 
+#include <sycl/sycl.hpp>
+
+#include "device_capabilities.h"
 #include "singleton.h"
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <unordered_map>
 
 namespace sycl_cts {
 namespace util {
 
 class device_manager : public singleton<device_manager> {
  public:
-  void set_device_regex(std::regex re) { device_regex = std::move(re); }
+  void set_device_regex(std::regex re) {
+    std::lock_guard<std::mutex> lock(resolve_mutex);
+    device_regex = std::move(re);
+    resolved.reset();
+  }
 
   /**
    * @return The regex set by the `--device` CLI parameter, used for selecting
@@ -42,19 +53,89 @@ class device_manager : public singleton<device_manager> {
     return device_regex;
   }
 
+  /**
+   * Rates the device according to the `--device` CLI parameter, or using the
+   * default selector if no parameter was given. Evaluated for every available
+   * device once per CTS run, when the CTS device is resolved.
+   */
+  int rate_device(const sycl::device& dev) const;
+
+  /**
+   * @return The device used for this CTS run. The device is resolved on the
+   * first call and cached afterwards.
+   */
+  const sycl::device& get_device() { return resolve().device; }
+
+  /**
+   * @return The platform of the device used for this CTS run
+   */
+  const sycl::platform& get_platform() { return resolve().platform; }
+
+  /**
+   * @return The context shared by all queues created through
+   * get_cts_object::queue(), associated with the CTS device only
+   */
+  const sycl::context& get_context() { return resolve().context; }
+
+  /**
+   * Records that a cached object was used instead of running the CTS device
+   * selector over all available devices.
+   */
+  void count_avoided_selection() {
+    avoided_selector_evaluations += resolve().device_count;
+  }
+
+  /**
+   * @return The number of device selector evaluations avoided so far by
+   * reusing the cached device
+   */
+  std::size_t get_avoided_selector_evaluations() const {
+    return avoided_selector_evaluations;
+  }
+
+  /**
+   * @return The capabilities of the given device, queried on the first call
+   * for the device and cached afterwards
+   */
+  const device_capabilities& get_capabilities(const sycl::device& dev);
+
+  /**
+   * @return The capabilities of the device used for this CTS run
+   */
+  const device_capabilities& get_capabilities() {
+    return get_capabilities(get_device());
+  }
+
   /**
    * Lists all available devices, indicating the currently selected one.
    */
-  void list_devices() const;
+  void list_devices();
 
   /**
    * Dumps information about the device used for this CTS run to a
-   * file, to be used by the conformance report generation script.
+   * file, to be used by the conformance report generation script. The
+   * capabilities of the device are included to let the script skip the tests
+   * requiring missing aspects.
    */
   void dump_info(const std::string& infoDumpFile);
 
  private:
+  struct resolved_device {
+    sycl::device device;
+    sycl::platform platform;
+    sycl::context context;
+    std::size_t device_count;
+  };
+
+  const resolved_device& resolve();
+
   std::optional<std::regex> device_regex;
+  std::optional<resolved_device> resolved;
+  std::mutex resolve_mutex;
+  // Node-based, so the references handed out stay valid on insertion
+  std::unordered_map<sycl::device, device_capabilities> capabilities;
+  std::mutex capabilities_mutex;
+  std::atomic<std::size_t> avoided_selector_evaluations{0};
 };
 
 }  // namespace util
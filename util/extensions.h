@@ -10,6 +10,7 @@
 #define __SYCLCTS_UTIL_EXTENSIONS_H
 
 #include <sycl/sycl.hpp>
+#include "device_manager.h"
 #include "logger.h"
 
 #include <string>
@@ -81,7 +82,9 @@ struct availability {
    *  @brief Verify extension availability without log messages
    */
   static inline bool check(const sycl::queue& queue) {
-    return queue.get_device().has(aspect<tagT>());
+    return sycl_cts::util::get<sycl_cts::util::device_manager>()
+        .get_capabilities(queue.get_device())
+        .has(aspect<tagT>());
   }
   /**
    *  @brief Verify extension availability with default log messages
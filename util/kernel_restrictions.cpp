@@ -7,8 +7,7 @@
 *******************************************************************************/
 
 #include "kernel_restrictions.h"
-
-#include <algorithm>
+#include "device_manager.h"
 
 namespace sycl_cts::util {
 
@@ -40,16 +39,12 @@ void kernel_restrictions::add_aspects(const aspect::aspect_set& asp) {
 bool kernel_restrictions::is_compatible(const sycl::device& device,
                                         std::string& info) const {
   bool compatible = true;
+  const auto& capabilities = get<device_manager>().get_capabilities(device);
   // Verify optional aspects support if required
   if (!m_aspects.empty()) {
-    aspect::aspect_set incompat_aspects;
-    for (const auto aspect : m_aspects) {
-      if (!device.has(aspect)) {
-        compatible = false;
-        incompat_aspects.insert(aspect);
-      }
-    }
+    const auto incompat_aspects = capabilities.get_missing(m_aspects);
     if (!incompat_aspects.empty()) {
+      compatible = false;
       info += "incompatible with aspects: (" +
               aspect::to_string(incompat_aspects) + "); ";
     }
@@ -58,12 +53,7 @@ bool kernel_restrictions::is_compatible(const sycl::device& device,
   // Verify sub_group_size restriction if any
   if (sub_group_size.first) {
     const size_t requested = sub_group_size.second;
-    const auto available =
-        device.get_info<sycl::info::device::sub_group_sizes>();
-    const auto begin = available.begin();
-    const auto end = available.end();
-
-    const bool has_sg_size = std::find(begin, end, requested) != end;
+    const bool has_sg_size = capabilities.has_sub_group_size(requested);
     compatible &= has_sg_size;
     if (!has_sg_size) {
       info += "incompatible with sub_group_size: (" +
@@ -78,9 +68,7 @@ bool kernel_restrictions::is_compatible(const sycl::device& device,
       requested *= work_group_size[dim];
     }
 
-    const auto available =
-        device.get_info<sycl::info::device::max_work_group_size>();
-    const bool has_wg_size = requested <= available;
+    const bool has_wg_size = requested <= capabilities.max_work_group_size;
     compatible &= has_wg_size;
     if (!has_wg_size) {
       info += "incompatible with work_group_size (" +
@@ -0,0 +1,69 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
+#define __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
+
+#include "thread_pool.h"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+
+namespace reference {
+
+/**
+ * @brief Evaluates fn element-wise over the input arrays on the host thread
+ *        pool: out[i] = fn(in[i]...)
+ *
+ * Arrays can be any contiguous containers providing data() and size(), e.g.
+ * std::vector or sycl::span. All arrays must have the same size.
+ * The floating point environment of the calling thread is used for every
+ * element, see sycl_cts::util::thread_pool::parallel_for.
+ *
+ * Note that std::vector<bool> is not contiguous; use an array of char to
+ * collect boolean results instead.
+ *
+ * @param fn Functor to evaluate, e.g. a lambda calling reference::sin; it is
+ *        called concurrently, so it must not modify any shared state
+ * @param out Array for the results
+ * @param in Arrays of the arguments
+ */
+template <typename FunT, typename OutT, typename... InT>
+void eval_batch(const FunT& fn, OutT&& out, const InT&... in) {
+  const std::size_t count = std::size(out);
+  assert(((std::size(in) == count) && ...));
+
+  auto* outData = std::data(out);
+  const auto inData = std::make_tuple(std::data(in)...);
+
+  sycl_cts::util::get<sycl_cts::util::thread_pool>().parallel_for(
+      count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          outData[i] = std::apply(
+              [&](const auto*... inPtr) { return fn(inPtr[i]...); }, inData);
+        }
+      });
+}
+
+}  // namespace reference
+
+#endif  // __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
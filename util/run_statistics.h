@@ -0,0 +1,106 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_RUN_STATISTICS_H
+#define __SYCLCTS_UTIL_RUN_STATISTICS_H
+
+#include "singleton.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Collects the counters and measurements reported per test case by the timing
+ * listener.
+ *
+ * The submissions and host waits of a sycl::queue cannot be intercepted
+ * without replacing the queue type used by the tests, so the counters only
+ * cover the calls of the CTS queue helpers, not the use of the queues.
+ */
+class run_statistics : public singleton<run_statistics> {
+ public:
+  struct measurement {
+    std::string name;
+    double value;
+    std::string unit;
+  };
+
+  /**
+   * Records a queue created through get_cts_object::queue()
+   */
+  void count_queue_creation() { ++queues_created; }
+
+  /**
+   * Records a request of the queue shared within a translation unit through
+   * once_per_unit::get_queue()
+   */
+  void count_shared_queue_request() { ++shared_queue_requests; }
+
+  std::size_t get_queues_created() const { return queues_created; }
+
+  std::size_t get_shared_queue_requests() const {
+    return shared_queue_requests;
+  }
+
+  /**
+   * Records a value measured by the running test case, e.g. a throughput,
+   * to report along with its timing. Can be called from any host thread.
+   */
+  void record_measurement(std::string name, double value, std::string unit) {
+    std::lock_guard<std::mutex> lock(measurements_mutex);
+    measurements.push_back({std::move(name), value, std::move(unit)});
+  }
+
+  /**
+   * @return The measurements recorded since the previous call
+   */
+  std::vector<measurement> take_measurements() {
+    std::lock_guard<std::mutex> lock(measurements_mutex);
+    return std::exchange(measurements, {});
+  }
+
+  void set_timing_dump_file(std::string file) {
+    timing_dump_file = std::move(file);
+  }
+
+  /**
+   * @return The file to write the per-test timing into, empty if disabled
+   */
+  const std::string& get_timing_dump_file() const { return timing_dump_file; }
+
+ private:
+  std::atomic<std::size_t> queues_created{0};
+  std::atomic<std::size_t> shared_queue_requests{0};
+  std::mutex measurements_mutex;
+  std::vector<measurement> measurements;
+  std::string timing_dump_file;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_RUN_STATISTICS_H
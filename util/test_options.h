@@ -0,0 +1,118 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_TEST_OPTIONS_H
+#define __SYCLCTS_UTIL_TEST_OPTIONS_H
+
+#include "singleton.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Holds the CLI parameters which tune the behavior of individual tests, as
+ * opposed to the parameters handled by Catch2 or the device_manager.
+ */
+class test_options : public singleton<test_options> {
+ public:
+  void set_math_sweep_stride(std::uint64_t stride) {
+    math_sweep_stride = stride;
+  }
+
+  /**
+   * @return The distance between two consecutive float bit patterns evaluated
+   * by the math built-ins sweep, set by the `--math-sweep-stride` CLI
+   * parameter. Stride of 1 evaluates all 2^32 bit patterns.
+   */
+  std::uint64_t get_math_sweep_stride() const { return math_sweep_stride; }
+
+  void set_math_sweep_chunk_size(std::size_t size) {
+    math_sweep_chunk_size = size;
+  }
+
+  /**
+   * @return The number of values evaluated by a single kernel launch of the
+   * math built-ins sweep, set by the `--math-sweep-chunk-size` CLI parameter.
+   */
+  std::size_t get_math_sweep_chunk_size() const {
+    return math_sweep_chunk_size;
+  }
+
+  void set_max_submission_threads(std::size_t count) {
+    max_submission_threads = count;
+  }
+
+  /**
+   * @return The largest number of host threads submitting at once in the
+   * concurrency tests, set by the `--max-submission-threads` CLI parameter.
+   */
+  std::size_t get_max_submission_threads() const {
+    return max_submission_threads;
+  }
+
+  void set_group_algorithms_size(std::size_t size) {
+    group_algorithms_size = size;
+  }
+
+  /**
+   * @return The number of elements processed by each group algorithm in the
+   * size-scaled group functions tests, set by the `--group-algorithms-size`
+   * CLI parameter.
+   */
+  std::size_t get_group_algorithms_size() const {
+    return group_algorithms_size;
+  }
+
+  void set_reduction_size(std::size_t size) { reduction_size = size; }
+
+  /**
+   * @return The number of work-items of the large-scale reduction tests, set
+   * by the `--reduction-size` CLI parameter.
+   */
+  std::size_t get_reduction_size() const { return reduction_size; }
+
+  void set_usm_benchmark_max_bytes(std::size_t bytes) {
+    usm_benchmark_max_bytes = bytes;
+  }
+
+  /**
+   * @return The largest transfer size of the USM bandwidth benchmark, set by
+   * the `--usm-max-bytes` CLI parameter.
+   */
+  std::size_t get_usm_benchmark_max_bytes() const {
+    return usm_benchmark_max_bytes;
+  }
+
+ private:
+  std::uint64_t math_sweep_stride = 4099;
+  std::size_t math_sweep_chunk_size = 1 << 20;
+  std::size_t max_submission_threads = 16;
+  std::size_t group_algorithms_size = 1 << 22;
+  std::size_t reduction_size = 1 << 24;
+  std::size_t usm_benchmark_max_bytes = std::size_t{1} << 30;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_TEST_OPTIONS_H
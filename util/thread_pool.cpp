@@ -0,0 +1,142 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace sycl_cts {
+namespace util {
+
+// Set for the pool threads and for the thread running parallel_for
+static thread_local bool inside_parallel_for = false;
+
+thread_pool::thread_pool() {
+  const unsigned hardwareThreads = std::thread::hardware_concurrency();
+  const std::size_t workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+  for (std::size_t i = 0; i < workerCount; ++i) {
+    workers.emplace_back([this] { worker_loop(); });
+  }
+}
+
+thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void thread_pool::worker_loop() {
+  inside_parallel_for = true;
+  unsigned long long seenGeneration = 0;
+  while (true) {
+    job* j = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(state_mutex);
+      wake.wait(lock,
+                [&] { return stopping || generation != seenGeneration; });
+      if (stopping) return;
+      seenGeneration = generation;
+      j = current;
+    }
+
+    std::fenv_t savedEnv;
+    std::fegetenv(&savedEnv);
+    std::fesetenv(&j->env);
+    run(*j);
+    std::fesetenv(&savedEnv);
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      // Every worker acknowledges every job, so the job can't be released
+      // before all workers stopped referring to it
+      if (--pending == 0) done.notify_all();
+    }
+  }
+}
+
+void thread_pool::run(job& j) {
+  while (true) {
+    const std::size_t begin = j.next.fetch_add(j.grain);
+    if (begin >= j.count) return;
+    const std::size_t end = std::min(begin + j.grain, j.count);
+    try {
+      (*j.body)(begin, end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      if (!error) error = std::current_exception();
+      j.next = j.count;
+    }
+  }
+}
+
+void thread_pool::parallel_for(std::size_t count, const range_body& body) {
+  if (count == 0) return;
+
+  // Ranges are taken dynamically, as the cost of the reference often depends
+  // on the input value; several ranges per thread keep the load balanced
+  const std::size_t grain =
+      std::max<std::size_t>(1, count / (get_concurrency() * 16));
+
+  if (workers.empty() || inside_parallel_for || count <= grain) {
+    body(0, count);
+    return;
+  }
+
+  std::lock_guard<std::mutex> submitLock(submit_mutex);
+  inside_parallel_for = true;
+
+  job j;
+  j.body = &body;
+  j.count = count;
+  j.grain = grain;
+  j.next = 0;
+  std::fegetenv(&j.env);
+
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    current = &j;
+    pending = workers.size();
+    error = nullptr;
+    ++generation;
+  }
+  wake.notify_all();
+
+  run(j);
+
+  std::exception_ptr jobError;
+  {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    done.wait(lock, [&] { return pending == 0; });
+    current = nullptr;
+    jobError = error;
+    error = nullptr;
+  }
+  inside_parallel_for = false;
+
+  if (jobError) std::rethrow_exception(jobError);
+}
+
+}  // namespace util
+}  // namespace sycl_cts
@@ -0,0 +1,101 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2023 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_THREAD_POOL_H
+#define __SYCLCTS_UTIL_THREAD_POOL_H
+
+#include "singleton.h"
+
+#include <atomic>
+#include <cfenv>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Pool of host threads used to speed up host-side computations over large
+ * arrays, e.g. evaluation of the reference results.
+ */
+class thread_pool : public singleton<thread_pool> {
+ public:
+  using range_body = std::function<void(std::size_t begin, std::size_t end)>;
+
+  thread_pool();
+  ~thread_pool() override;
+
+  /**
+   * @return The number of threads participating in parallel_for, including
+   * the calling one
+   */
+  std::size_t get_concurrency() const { return workers.size() + 1; }
+
+  /**
+   * Splits [0, count) into contiguous ranges and calls body(begin, end) for
+   * each of them from the pool threads and the calling thread. Returns once
+   * all ranges are processed.
+   *
+   * The floating point environment of the calling thread (rounding mode,
+   * flush-to-zero state) is applied to the pool threads for the duration of
+   * the call, so the results do not depend on the thread evaluating them.
+   *
+   * The first exception thrown by body is rethrown from parallel_for; the
+   * remaining ranges are skipped in that case. Nested calls from within body
+   * are executed serially by the calling thread.
+   */
+  void parallel_for(std::size_t count, const range_body& body);
+
+ private:
+  struct job {
+    const range_body* body;
+    std::size_t count;
+    std::size_t grain;
+    std::atomic<std::size_t> next;
+    std::fenv_t env;
+  };
+
+  void worker_loop();
+  void run(job& j);
+
+  std::vector<std::thread> workers;
+
+  // Serializes parallel_for calls from different host threads
+  std::mutex submit_mutex;
+
+  std::mutex state_mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  job* current = nullptr;
+  unsigned long long generation = 0;
+  std::size_t pending = 0;
+  bool stopping = false;
+  std::exception_ptr error;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_THREAD_POOL_H